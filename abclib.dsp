@@ -111,6 +111,10 @@ SOURCE=.\src\base\abc\abcCheck.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\abc\abcCsr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\abc\abcDfs.c
 # End Source File
 # Begin Source File
@@ -1303,6 +1307,10 @@ SOURCE=.\src\bdd\llb\llb2Image.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\llb\llb2Pth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\llb\llb3Image.c
 # End Source File
 # Begin Source File
@@ -2103,6 +2111,10 @@ SOURCE=.\src\sat\bmc\bmcInse.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcKInd.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcLoad.c
 # End Source File
 # Begin Source File
@@ -3103,6 +3115,10 @@ SOURCE=.\src\opt\dau\dau.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauBatch.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
@@ -3251,6 +3267,10 @@ SOURCE=.\src\opt\fxch\FxchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\fxch\FxchPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\fxch\FxchSCHashTable.c
 # End Source File
 # End Group
@@ -3743,6 +3763,10 @@ SOURCE=.\src\map\scl\sclSize.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclTimePth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclSize.h
 # End Source File
 # Begin Source File
@@ -5071,6 +5095,10 @@ SOURCE=.\src\aig\gia\giaKf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaLevel.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaLf.c
 # End Source File
 # Begin Source File
@@ -5131,6 +5159,10 @@ SOURCE=.\src\aig\gia\giaPf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaPool.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaQbf.c
 # End Source File
 # Begin Source File
@@ -5679,6 +5711,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -5883,6 +5919,14 @@ SOURCE=.\src\proof\int\intMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intOnline.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\proof\int\intPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intUtil.c
 # End Source File
 # End Group
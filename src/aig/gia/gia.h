@@ -53,6 +53,7 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_LevMan_t_         Gia_LevMan_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -1410,6 +1411,7 @@ extern int                 Gia_ManEquivCountClasses( Gia_Man_t * p );
 extern void                Gia_ManEquivPrintOne( Gia_Man_t * p, int i, int Counter );
 extern void                Gia_ManEquivPrintClasses( Gia_Man_t * p, int fVerbose, float Mem );
 extern Gia_Man_t *         Gia_ManEquivReduce( Gia_Man_t * p, int fUseAll, int fDualOut, int fSkipPhase, int fVerbose );
+extern Gia_Man_t *         Gia_ManEquivReduceLevel( Gia_Man_t * p, int fUseAll, int fDualOut, int fCheck, int fVerbose );
 extern Gia_Man_t *         Gia_ManEquivReduceAndRemap( Gia_Man_t * p, int fSeq, int fMiterPairs );
 extern int                 Gia_ManEquivSetColors( Gia_Man_t * p, int fVerbose );
 extern Gia_Man_t *         Gia_ManSpecReduce( Gia_Man_t * p, int fDualOut, int fSynthesis, int fReduce, int fSkipSome, int fVerbose );
@@ -1493,13 +1495,28 @@ extern Gia_Man_t *         Gia_ManPerformMapping( Gia_Man_t * p, void * pIfPars
 extern Gia_Man_t *         Gia_ManPerformSopBalance( Gia_Man_t * p, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalance( Gia_Man_t * p, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupHashMapping( Gia_Man_t * p );
+/*=== giaLevel.c ===========================================================*/
+extern Gia_LevMan_t *      Gia_LevManStart( Gia_Man_t * pGia, int nLevelIncrease );
+extern void                Gia_LevManStop( Gia_LevMan_t * p );
+extern void                Gia_LevManAppend( Gia_LevMan_t * p );
+extern void                Gia_LevManReplace( Gia_LevMan_t * p, int iObj, int iLitNew );
+extern int                 Gia_LevManVerify( Gia_LevMan_t * p, int fVerbose );
+extern int                 Gia_LevManLevelMax( Gia_LevMan_t * p );
+extern void                Gia_LevManSetLevelMax( Gia_LevMan_t * p, int Level );
+extern int                 Gia_LevManCoLevelMax( Gia_LevMan_t * p );
+extern int                 Gia_LevObjLevel( Gia_LevMan_t * p, int iObj );
+extern int                 Gia_LevObjLevelR( Gia_LevMan_t * p, int iObj );
+extern int                 Gia_LevObjRequired( Gia_LevMan_t * p, int iObj );
+extern int                 Gia_LevObjSlack( Gia_LevMan_t * p, int iObj );
+extern int                 Gia_LevObjIsDead( Gia_LevMan_t * p, int iObj );
+extern int                 Gia_LevLitRepr( Gia_LevMan_t * p, int iLit );
 /*=== giaJf.c ===========================================================*/
 extern void                Jf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Jf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
 extern Gia_Man_t *         Jf_ManDeriveCnf( Gia_Man_t * p, int fCnfObjIds );
 /*=== giaIso.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManIsoCanonicize( Gia_Man_t * p, int fVerbose );
-extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose );
+extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int nProcs, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce2( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fBetterQual, int fDualOut, int fVerbose, int fVeryVerbose );
 /*=== giaLf.c ===========================================================*/
 extern void                Lf_ManSetDefaultPars( Jf_Par_t * pPars );
@@ -1558,6 +1575,12 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p, int fSkipBufs );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaPool.c ===========================================================*/
+extern Gia_Obj_t *         Gia_ManPoolObjsAlloc( int nObjs );
+extern void                Gia_ManPoolObjsRecycle( Gia_Obj_t * pObjs, int nObjs );
+extern void                Gia_ManPoolIntsGrow( Vec_Int_t * v, int nSize );
+extern void                Gia_ManPoolIntsRecycle( Vec_Int_t * v );
+extern void                Gia_ManPoolQuit();
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
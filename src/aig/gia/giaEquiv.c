@@ -715,6 +715,122 @@ Gia_Man_t * Gia_ManEquivReduce( Gia_Man_t * p, int fUseAll, int fDualOut, int fS
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the AIG through the replacements of the level manager.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManEquivReduceLevel_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_LevMan_t * pLev, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iLit0, iLit1;
+    if ( ~pObj->Value )
+        return pObj->Value;
+    assert( Gia_ObjIsAnd(pObj) );
+    iLit0 = Gia_LevLitRepr( pLev, Gia_ObjFaninLit0(pObj, iObj) );
+    iLit1 = Gia_LevLitRepr( pLev, Gia_ObjFaninLit1(pObj, iObj) );
+    iLit0 = Abc_LitNotCond( Gia_ManEquivReduceLevel_rec(pNew, p, pLev, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0) );
+    iLit1 = Abc_LitNotCond( Gia_ManEquivReduceLevel_rec(pNew, p, pLev, Abc_Lit2Var(iLit1)), Abc_LitIsCompl(iLit1) );
+    return pObj->Value = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reduces AIG using equivalence classes without increasing levels.]
+
+  Description [Visits the AND nodes in a topological order and replaces
+  the node by its representative only if the representative arrives not
+  later than the required level of the node, so that the number of levels
+  does not increase. The levels and the required levels are updated
+  incrementally by the level manager after each replacement. If fCheck
+  is set, they are compared with a full recomputation after each
+  replacement.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManEquivReduceLevel( Gia_Man_t * p, int fUseAll, int fDualOut, int fCheck, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    Gia_LevMan_t * pLev;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, iLit, nLevels, nMerged = 0, nSkipped = 0, nErrors = 0;
+    abctime clk = Abc_Clock();
+    if ( !p->pReprs )
+    {
+        Abc_Print( 1, "Gia_ManEquivReduceLevel(): Equivalence classes are not available.\n" );
+        return NULL;
+    }
+    if ( fDualOut && (Gia_ManPoNum(p) & 1) )
+    {
+        Abc_Print( 1, "Gia_ManEquivReduceLevel(): Dual-output miter should have even number of POs.\n" );
+        return NULL;
+    }
+    if ( p->pMuxes )
+    {
+        Abc_Print( 1, "Gia_ManEquivReduceLevel(): The AIG should not contain MUXes and XORs.\n" );
+        return NULL;
+    }
+    Gia_ManSetPhase( p );
+    if ( fDualOut )
+        Gia_ManEquivSetColors( p, fVerbose );
+    // merge the nodes whose representatives have enough slack
+    pLev = Gia_LevManStart( p, 0 );
+    nLevels = Gia_LevManLevelMax( pLev );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Gia_LevObjIsDead(pLev, i) || (pRepr = Gia_ManEquivRepr(p, pObj, fUseAll, fDualOut)) == NULL )
+            continue;
+        iLit = Abc_Var2Lit( Gia_ObjId(p, pRepr), Gia_ObjPhaseReal(pRepr) ^ Gia_ObjPhaseReal(pObj) );
+        iLit = Gia_LevLitRepr( pLev, iLit );
+        if ( Gia_LevObjLevel(pLev, Abc_Lit2Var(iLit)) > Gia_LevObjRequired(pLev, i) )
+        {
+            nSkipped++;
+            continue;
+        }
+        Gia_LevManReplace( pLev, i, iLit );
+        nMerged++;
+        if ( fCheck && !Gia_LevManVerify(pLev, 0) )
+            nErrors++;
+    }
+    assert( Gia_LevManCoLevelMax(pLev) <= nLevels );
+    // derive the reduced AIG
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi(pNew);
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManEquivReduceLevel_rec( pNew, p, pLev, Abc_Lit2Var(Gia_LevLitRepr(pLev, Gia_ObjFaninLit0p(p, pObj))) );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iLit = Gia_LevLitRepr( pLev, Gia_ObjFaninLit0p(p, pObj) );
+        pObj->Value = Gia_ManAppendCo( pNew, Abc_LitNotCond(Gia_ManObj(p, Abc_Lit2Var(iLit))->Value, Abc_LitIsCompl(iLit)) );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Gia_LevManStop( pLev );
+    if ( fCheck && nErrors )
+        Abc_Print( 1, "Gia_ManEquivReduceLevel(): Incremental levels differ from recomputed ones after %d of %d replacements.\n", nErrors, nMerged );
+    if ( fVerbose )
+    {
+        printf( "Merged %d nodes. Skipped %d merges increasing levels. Levels = %d -> %d. ", nMerged, nSkipped, nLevels, Gia_ManLevelNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Duplicates the AIG in the DFS order.]
@@ -104,8 +104,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nTableSize = Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc );
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
+    Gia_ManPoolIntsGrow( &p->vHTable, nTableSize );
+    Gia_ManPoolIntsGrow( &p->vHash, Abc_MaxInt(nTableSize, Gia_ManObjNum(p)) );
+    Vec_IntFill( &p->vHTable, nTableSize, 0 );
     Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
     Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
 //printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
@@ -148,8 +151,8 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    Gia_ManPoolIntsRecycle( &p->vHTable );
+    Gia_ManPoolIntsRecycle( &p->vHash );
 }
 
 /**Function*************************************************************
@@ -20,10 +20,22 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
  
 
 #define ISO_MASK 0xFF
+#define ISO_THR_MAX 64
 static unsigned int s_256Primes[ISO_MASK+1] = 
 {
     0x984b6ad9,0x18a6eed3,0x950353e2,0x6222f6eb,0xdfbedd47,0xef0f9023,0xac932a26,0x590eaf55,
@@ -72,6 +84,7 @@ struct Gia_IsoMan_t_
     int              nUniques;
     int              nSingles;
     int              nEntries;
+    int              nProcs;
     // internal data
     int *            pLevels;
     int *            pUniques;
@@ -96,6 +109,19 @@ static inline unsigned  Gia_IsoGetItem( Gia_IsoMan_t * p, int i )              {
 static inline void      Gia_IsoSetValue( Gia_IsoMan_t * p, int i, unsigned v ) { ((unsigned *)(p->pStoreW + i))[0] = v;  }
 static inline void      Gia_IsoSetItem( Gia_IsoMan_t * p, int i, unsigned v )  { ((unsigned *)(p->pStoreW + i))[1] = v;  }
 
+typedef struct Gia_IsoThData_t_    Gia_IsoThData_t;
+struct Gia_IsoThData_t_ 
+{
+    Gia_IsoMan_t *   pMan;         // the manager whose classes are sorted
+    Gia_Man_t *      pGia;         // the copy of the AIG used to compute strings
+    Vec_Int_t *      vPos;         // the outputs whose strings are computed
+    Vec_Ptr_t *      vStrs;        // the resulting strings
+    Vec_Ptr_t *      vPiPerms;     // the resulting PI permutations
+    int              iStart;       // the first entry processed by this thread
+    int              iStop;        // the entry following the last one
+    int              iStep;        // the distance between the entries
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -287,55 +313,133 @@ void Gia_IsoAssignUnique( Gia_IsoMan_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Sorts the entries of the classes by their values.]
 
-  Description []
+  Description [Classes are given by the range [iStart, iStop) of entries
+  in p->vClasses. Different classes occupy different parts of the storage,
+  so they can be sorted concurrently.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_IsoSort( Gia_IsoMan_t * p )
+void Gia_IsoSortClasses( Gia_IsoMan_t * p, int iStart, int iStop )
 {
-    Gia_Obj_t * pObj, * pObj0;
-    int i, k, fSameValue, iBegin, iBeginOld, nSize, nSizeNew;
-    int fRefined = 0;
-    abctime clk;
-
-    // go through the equiv classes
-    p->nSingles = 0;
-    Vec_IntClear( p->vClasses2 );
-    Vec_IntForEachEntryDouble( p->vClasses, iBegin, nSize, i )
+    Gia_Obj_t * pObj;
+    int i, k, fSameValue, iBegin, nSize;
+    for ( i = iStart; i < iStop; i += 2 )
     {
+        iBegin = Vec_IntEntry( p->vClasses, i );
+        nSize  = Vec_IntEntry( p->vClasses, i+1 );
         assert( nSize > 1 );
         fSameValue = 1;
-        pObj0 = Gia_ManObj( p->pGia, Gia_IsoGetItem(p,iBegin) );
         for ( k = 0; k < nSize; k++ )
         {
             pObj = Gia_ManObj( p->pGia, Gia_IsoGetItem(p,iBegin+k) );
             Gia_IsoSetValue( p, iBegin+k, pObj->Value );
-            if ( pObj->Value != pObj0->Value )
+            if ( pObj->Value != Gia_IsoGetValue(p, iBegin) )
                 fSameValue = 0;
         }
-        if ( fSameValue )
+        if ( !fSameValue )
+            Abc_QuickSort3( p->pStoreW + iBegin, nSize, 0 );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Gia_IsoSortThread( void * pArg )
+{
+    Gia_IsoThData_t * pThData = (Gia_IsoThData_t *)pArg;
+    Gia_IsoSortClasses( pThData->pMan, pThData->iStart, pThData->iStop );
+    return NULL;
+}
+void Gia_IsoSortAll( Gia_IsoMan_t * p )
+{
+    Gia_IsoThData_t ThData[ISO_THR_MAX];
+    pthread_t WorkerThread[ISO_THR_MAX];
+    int i, t, status, nEntries = 0, nProcs = Abc_MinInt( p->nProcs, ISO_THR_MAX );
+    // small problems are not worth starting the threads
+    if ( nProcs < 2 || p->nEntries < 10000 || Vec_IntSize(p->vClasses) < 4 * nProcs )
+    {
+        Gia_IsoSortClasses( p, 0, Vec_IntSize(p->vClasses) );
+        return;
+    }
+    // divide the classes into ranges with similar numbers of entries
+    ThData[0].iStart = 0;
+    for ( i = t = 0; i < Vec_IntSize(p->vClasses); i += 2 )
+    {
+        nEntries += Vec_IntEntry( p->vClasses, i+1 );
+        if ( t < nProcs - 1 && nEntries >= (t + 1) * (p->nEntries / nProcs) )
+        {
+            ThData[t].iStop    = i + 2;
+            ThData[++t].iStart = i + 2;
+        }
+    }
+    ThData[t].iStop = Vec_IntSize(p->vClasses);
+    nProcs = t + 1;
+    // the calling thread sorts the first range
+    for ( t = 1; t < nProcs; t++ )
+    {
+        ThData[t].pMan = p;
+        status = pthread_create( WorkerThread + t, NULL, Gia_IsoSortThread, (void *)(ThData + t) );
+        assert( status == 0 );
+    }
+    Gia_IsoSortClasses( p, ThData[0].iStart, ThData[0].iStop );
+    for ( t = 1; t < nProcs; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );
+        assert( status == 0 );
+    }
+}
+#else
+void Gia_IsoSortAll( Gia_IsoMan_t * p )
+{
+    Gia_IsoSortClasses( p, 0, Vec_IntSize(p->vClasses) );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using the current values.]
+
+  Description [The entries of each class are sorted first (on concurrent
+  threads, if requested). After that, the classes are split in their
+  original order, which makes the unique numbers of the objects the same
+  as when sorting on one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_IsoSort( Gia_IsoMan_t * p )
+{
+    int i, k, iBegin, iBeginOld, nSize, nSizeNew;
+    int fRefined = 0;
+    abctime clk;
+
+    // sort the entries of each class
+    clk = Abc_Clock();
+    Gia_IsoSortAll( p );
+    p->timeSort += Abc_Clock() - clk;
+
+    // go through the equiv classes
+    p->nSingles = 0;
+    Vec_IntClear( p->vClasses2 );
+    Vec_IntForEachEntryDouble( p->vClasses, iBegin, nSize, i )
+    {
+        // the class is not refined if the values of the smallest and the largest entries are the same
+        if ( Gia_IsoGetValue(p, iBegin) == Gia_IsoGetValue(p, iBegin+nSize-1) )
         {
             Vec_IntPush( p->vClasses2, iBegin );
             Vec_IntPush( p->vClasses2, nSize );
             continue;
         }
         fRefined = 1;
-        // sort objects
-        clk = Abc_Clock();
-        Abc_QuickSort3( p->pStoreW + iBegin, nSize, 0 );
-        p->timeSort += Abc_Clock() - clk;
         // divide into new classes
         iBeginOld = iBegin;
-        pObj0 = Gia_ManObj( p->pGia, Gia_IsoGetItem(p,iBegin) );
         for ( k = 1; k < nSize; k++ )
         {
-            pObj = Gia_ManObj( p->pGia, Gia_IsoGetItem(p,iBegin+k) );
-            if ( pObj0->Value == pObj->Value )
+            if ( Gia_IsoGetValue(p, iBeginOld) == Gia_IsoGetValue(p, iBegin+k) )
                 continue;
             nSizeNew = iBegin + k - iBeginOld;
             if ( nSizeNew == 1 )
@@ -350,7 +454,6 @@ int Gia_IsoSort( Gia_IsoMan_t * p )
                 Vec_IntPush( p->vClasses2, nSizeNew );
             }
             iBeginOld = iBegin + k;
-            pObj0 = pObj;
         }
         // add the last one
         nSizeNew = iBegin + k - iBeginOld;
@@ -717,7 +820,7 @@ void Gia_IsoRecognizeMuxes( Gia_Man_t * pGia )
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Ptr_t * Gia_IsoDeriveEquivPos( Gia_Man_t * pGia, int fForward, int fVerbose )
+Vec_Ptr_t * Gia_IsoDeriveEquivPos( Gia_Man_t * pGia, int fForward, int nProcs, int fVerbose )
 {
     int nIterMax = 10000;
     int nFixedPoint = 1;
@@ -731,6 +834,7 @@ Vec_Ptr_t * Gia_IsoDeriveEquivPos( Gia_Man_t * pGia, int fForward, int fVerbose
 
     Gia_ManCleanValue( pGia );
     p = Gia_IsoManStart( pGia );
+    p->nProcs = nProcs;
     Gia_IsoPrepare( p );
     Gia_IsoAssignUnique( p );
     p->timeStart = Abc_Clock() - clk;
@@ -967,7 +1071,7 @@ Gia_Man_t * Gia_ManIsoCanonicize( Gia_Man_t * p, int fVerbose )
         return Gia_ManDup(p);
     }
     // derive canonical values
-    vEquiv = Gia_IsoDeriveEquivPos( p, 0, fVerbose );
+    vEquiv = Gia_IsoDeriveEquivPos( p, 0, 1, fVerbose );
     Vec_VecFreeP( (Vec_Vec_t **)&vEquiv );
     // find canonical order of CIs/COs/nodes
     // find canonical order
@@ -1016,7 +1120,7 @@ Vec_Str_t * Gia_ManIsoFindString( Gia_Man_t * p, int iPo, int fVerbose, Vec_Int_
         return vStr;
     }
     // derive canonical values
-    vEquiv = Gia_IsoDeriveEquivPos( pPart, 0, fVerbose );
+    vEquiv = Gia_IsoDeriveEquivPos( pPart, 0, 1, fVerbose );
     Vec_VecFreeP( (Vec_Vec_t **)&vEquiv );
     // find canonical order
     vCis  = Vec_IntAlloc( Gia_ManCiNum(pPart) );
@@ -1035,6 +1139,84 @@ Vec_Str_t * Gia_ManIsoFindString( Gia_Man_t * p, int iPo, int fVerbose, Vec_Int_
     return vStr;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes canonical strings of the outputs on several threads.]
+
+  Description [Returns the array of strings indexed by the output number,
+  which contains NULL for the outputs in the trivial classes. Computing
+  the string of an output modifies the AIG (see Gia_ManDupCones()), so
+  each thread works with its own copy. The outputs are distributed in a
+  round-robin fashion because the outputs in one class have similar cones.
+  Returns NULL if the threads are not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Gia_IsoStringThread( void * pArg )
+{
+    Gia_IsoThData_t * pThData = (Gia_IsoThData_t *)pArg;
+    Vec_Int_t ** ppPiPerms = pThData->vPiPerms ? (Vec_Int_t **)Vec_PtrArray(pThData->vPiPerms) : NULL;
+    int i, iPo;
+    for ( i = pThData->iStart; i < pThData->iStop; i += pThData->iStep )
+    {
+        iPo = Vec_IntEntry( pThData->vPos, i );
+        Vec_PtrWriteEntry( pThData->vStrs, iPo, Gia_ManIsoFindString(pThData->pGia, iPo, 0, ppPiPerms ? ppPiPerms + iPo : NULL) );
+    }
+    return NULL;
+}
+Vec_Ptr_t * Gia_ManIsoFindStrings( Gia_Man_t * p, Vec_Ptr_t * vEquivs, Vec_Ptr_t * vPiPerms, int nProcs )
+{
+    Gia_IsoThData_t ThData[ISO_THR_MAX];
+    pthread_t WorkerThread[ISO_THR_MAX];
+    Vec_Ptr_t * vStrs;
+    Vec_Int_t * vPos, * vLevel;
+    int i, status;
+    // collect the outputs in the non-trivial classes
+    vPos = Vec_IntAlloc( Gia_ManPoNum(p) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vEquivs, vLevel, i )
+        if ( Vec_IntSize(vLevel) > 1 )
+            Vec_IntAppend( vPos, vLevel );
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, ISO_THR_MAX), Vec_IntSize(vPos) );
+    vStrs = Vec_PtrStart( Gia_ManPoNum(p) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan     = NULL;
+        ThData[i].pGia     = i ? Gia_ManDup( p ) : p;
+        ThData[i].vPos     = vPos;
+        ThData[i].vStrs    = vStrs;
+        ThData[i].vPiPerms = vPiPerms;
+        ThData[i].iStart   = i;
+        ThData[i].iStop    = Vec_IntSize(vPos);
+        ThData[i].iStep    = nProcs;
+    }
+    // the calling thread uses the original AIG
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_IsoStringThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    if ( nProcs > 0 )
+        Gia_IsoStringThread( (void *)ThData );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        Gia_ManStop( ThData[i].pGia );
+    }
+    Vec_IntFree( vPos );
+    return vStrs;
+}
+#else
+Vec_Ptr_t * Gia_ManIsoFindStrings( Gia_Man_t * p, Vec_Ptr_t * vEquivs, Vec_Ptr_t * vPiPerms, int nProcs )
+{
+    return NULL;
+}
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1072,10 +1254,10 @@ int Vec_IntCountNonTrivial( Vec_Ptr_t * vEquivs, int * pnUsed )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int nProcs, int fVerbose, int fVeryVerbose )
 { 
     Gia_Man_t * p, * pPart;
-    Vec_Ptr_t * vEquivs, * vEquivs2, * vStrings;
+    Vec_Ptr_t * vEquivs, * vEquivs2, * vStrings, * vStrsAll = NULL;
     Vec_Int_t * vRemain, * vLevel, * vLevel2;
     Vec_Str_t * vStr, * vStr2;
     int i, k, s, sStart, iPo, Counter;
@@ -1103,7 +1285,7 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
     }
 
     // create preliminary equivalences
-    vEquivs = Gia_IsoDeriveEquivPos( p, 1, fVeryVerbose );
+    vEquivs = Gia_IsoDeriveEquivPos( p, 1, nProcs, fVeryVerbose );
     if ( vEquivs == NULL )
     {
         if ( fDualOut )
@@ -1120,6 +1302,10 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
         return Gia_ManDup(pInit);
     }
 
+    // compute the strings of all outputs in the non-trivial classes concurrently
+    if ( nProcs > 1 )
+        vStrsAll = Gia_ManIsoFindStrings( p, vEquivs, pvPiPerms ? *pvPiPerms : NULL, nProcs );
+
     // perform refinement of equivalence classes
     Counter = 0;
     vEquivs2 = Vec_PtrAlloc( 100 );
@@ -1149,8 +1335,13 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
         {
             if ( ++Counter % 100 == 0 )
                 printf( "%6d finished...\r", Counter );
-            assert( pvPiPerms == NULL || Vec_PtrArray(*pvPiPerms)[iPo] == NULL );
-            vStr = Gia_ManIsoFindString( p, iPo, 0, pvPiPerms ? (Vec_Int_t **)Vec_PtrArray(*pvPiPerms) + iPo : NULL );
+            if ( vStrsAll )
+                vStr = (Vec_Str_t *)Vec_PtrEntry( vStrsAll, iPo );
+            else
+            {
+                assert( pvPiPerms == NULL || Vec_PtrArray(*pvPiPerms)[iPo] == NULL );
+                vStr = Gia_ManIsoFindString( p, iPo, 0, pvPiPerms ? (Vec_Int_t **)Vec_PtrArray(*pvPiPerms) + iPo : NULL );
+            }
 
 //            printf( "Output %2d : ", iPo );
 //            Vec_IntPrint( Vec_PtrArray(*pvPiPerms)[iPo] );
@@ -1175,6 +1366,7 @@ Gia_Man_t * Gia_ManIsoReduce( Gia_Man_t * pInit, Vec_Ptr_t ** pvPosEquivs, Vec_P
         Vec_VecFree( (Vec_Vec_t *)vStrings );
     }
     assert( Counter == Gia_ManPoNum(p) );
+    Vec_PtrFreeP( &vStrsAll );
     Vec_VecSortByFirstInt( (Vec_Vec_t *)vEquivs2, 0 );
     Vec_VecFree( (Vec_Vec_t *)vEquivs );
     vEquivs = vEquivs2;
@@ -1242,7 +1434,7 @@ void Gia_IsoTestOld( Gia_Man_t * p, int fVerbose )
 {
     Vec_Ptr_t * vEquivs;
     abctime clk = Abc_Clock(); 
-    vEquivs = Gia_IsoDeriveEquivPos( p, 0, fVerbose );
+    vEquivs = Gia_IsoDeriveEquivPos( p, 0, 1, fVerbose );
     printf( "Reduced %d outputs to %d.  ", Gia_ManPoNum(p), vEquivs ? Vec_PtrSize(vEquivs) : 1 );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     if ( fVerbose && vEquivs && Gia_ManPoNum(p) != Vec_PtrSize(vEquivs) )
@@ -1296,7 +1488,7 @@ void Gia_IsoTest( Gia_Man_t * p, Abc_Cex_t * pCex, int fVerbose )
 //Gia_AigerWrite( pDouble, "test.aig", 0, 0, 0 );
 
     // analyze the two-output miter
-    pAig = Gia_ManIsoReduce( pDouble, &vPosEquivs, &vPisPerm, 0, 0, 0, 0 );
+    pAig = Gia_ManIsoReduce( pDouble, &vPosEquivs, &vPisPerm, 0, 0, 1, 0, 0 );
     Vec_VecFree( (Vec_Vec_t *)vPosEquivs );
 
     // given CEX for output 0, derive CEX for output 1
@@ -0,0 +1,637 @@
+/**CFile****************************************************************
+
+  FileName    [giaLevel.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental maintenance of levels and required levels.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaLevel.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The manager keeps the level (arrival) and the reverse level of each
+// object of the AIG while the AIG is being transformed. Since the objects
+// of Gia_Man_t cannot be edited in place, the transformations are expressed
+// as appending new nodes and replacing an old node by a literal, which
+// redirects the fanouts of the old node. The fanins are always looked up
+// through the replacement map, so the AIG itself is not modified.
+//
+// The levels follow Gia_ManLevelNum() and the reverse levels follow
+// Gia_ManReverseLevel(): the reverse level of a CO driver is 0, and the
+// required level of a node is LevelMax minus its reverse level.
+
+struct Gia_LevMan_t_
+{
+    Gia_Man_t *      pGia;          // the AIG
+    int              nLevelMax;     // the target of the required levels
+    Vec_Int_t *      vRepl;         // replacement literal of each object (-1 if none)
+    Vec_Wec_t *      vFanouts;      // fanouts of each object
+    Vec_Int_t *      vLevels;       // levels
+    Vec_Int_t *      vLevelsR;      // reverse levels
+    Vec_Wec_t *      vBuckets;      // the bucket queue (objects by old level)
+    Vec_Str_t *      vQueued;       // marks objects currently in the queue
+    Vec_Str_t *      vDead;         // marks nodes without fanouts after replacement
+    int              nUpdates;      // the number of levels recomputed
+};
+
+static inline int    Gia_LevObjDelay( Gia_LevMan_t * p, Gia_Obj_t * pObj )
+{
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    if ( !p->pGia->fGiaSimple && Gia_ObjIsBuf(pObj) )
+        return 0;
+    if ( Gia_ObjIsMux(p->pGia, pObj) || Gia_ObjIsXor(pObj) )
+        return 2;
+    return 1;
+}
+static inline int    Gia_LevLitResolve( Gia_LevMan_t * p, int iLit )
+{
+    int iRepl;
+    while ( (iRepl = Vec_IntEntry(p->vRepl, Abc_Lit2Var(iLit))) >= 0 )
+        iLit = Abc_LitNotCond( iRepl, Abc_LitIsCompl(iLit) );
+    return iLit;
+}
+static inline int    Gia_LevObjFaninNum( Gia_LevMan_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsCo(pObj) || (!p->pGia->fGiaSimple && Gia_ObjIsBuf(pObj)) )
+        return 1;
+    if ( Gia_ObjIsAnd(pObj) )
+        return 2 + Gia_ObjIsMux(p->pGia, pObj);
+    return 0;
+}
+static inline int    Gia_LevObjFaninId( Gia_LevMan_t * p, int iObj, int k )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iLit = k == 0 ? Gia_ObjFaninLit0(pObj, iObj) : k == 1 ? Gia_ObjFaninLit1(pObj, iObj) : p->pGia->pMuxes[iObj];
+    return Abc_Lit2Var( Gia_LevLitResolve(p, iLit) );
+}
+
+#define Gia_LevObjForEachFaninId( p, iObj, iFanin, k )  \
+    for ( k = 0; k < Gia_LevObjFaninNum(p, Gia_ManObj(p->pGia, iObj)) && ((iFanin) = Gia_LevObjFaninId(p, iObj, k), 1); k++ )
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the level of the object from its fanins.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_LevObjLevelNew( Gia_LevMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int k, iFanin, Level = 0;
+    Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+        Level = Abc_MaxInt( Level, Vec_IntEntry(p->vLevels, iFanin) );
+    return Level + Gia_LevObjDelay( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reverse level of the object from its fanouts.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_LevObjLevelRNew( Gia_LevMan_t * p, int iObj )
+{
+    Vec_Int_t * vFanouts = Vec_WecEntry( p->vFanouts, iObj );
+    int k, iFanout, LevelR = 0;
+    Vec_IntForEachEntry( vFanouts, iFanout, k )
+    {
+        Gia_Obj_t * pFanout = Gia_ManObj( p->pGia, iFanout );
+        if ( Gia_ObjIsCo(pFanout) )
+            continue;
+        LevelR = Abc_MaxInt( LevelR, Vec_IntEntry(p->vLevelsR, iFanout) + Gia_LevObjDelay(p, pFanout) );
+    }
+    return LevelR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extends the arrays to include the new objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManExtend( Gia_LevMan_t * p )
+{
+    int nObjs = Gia_ManObjNum( p->pGia );
+    if ( Vec_IntSize(p->vLevels) >= nObjs )
+        return;
+    Vec_IntFillExtra( p->vRepl,    nObjs, -1 );
+    Vec_IntFillExtra( p->vLevels,  nObjs, 0 );
+    Vec_IntFillExtra( p->vLevelsR, nObjs, 0 );
+    Vec_StrFillExtra( p->vQueued,  nObjs, 0 );
+    Vec_StrFillExtra( p->vDead,    nObjs, 0 );
+    if ( Vec_WecSize(p->vFanouts) < nObjs )
+    {
+        Vec_WecGrow( p->vFanouts, Abc_MaxInt(nObjs, 2 * Vec_WecSize(p->vFanouts)) );
+        p->vFanouts->nSize = nObjs;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager.]
+
+  Description [Computes levels and reverse levels of all objects. The
+  required levels are computed for the current number of levels increased
+  by nLevelIncrease.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_LevMan_t * Gia_LevManStart( Gia_Man_t * pGia, int nLevelIncrease )
+{
+    Gia_LevMan_t * p;
+    Gia_Obj_t * pObj;
+    int i, k, iFanin;
+    p = ABC_CALLOC( Gia_LevMan_t, 1 );
+    p->pGia     = pGia;
+    p->vRepl    = Vec_IntAlloc( 0 );
+    p->vFanouts = Vec_WecAlloc( 0 );
+    p->vLevels  = Vec_IntAlloc( 0 );
+    p->vLevelsR = Vec_IntAlloc( 0 );
+    p->vBuckets = Vec_WecAlloc( 100 );
+    p->vQueued  = Vec_StrAlloc( 0 );
+    p->vDead    = Vec_StrAlloc( 0 );
+    Gia_LevManExtend( p );
+    // levels and fanouts in the topological order
+    Gia_ManForEachObj( pGia, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vLevels, i, Gia_LevObjLevelNew(p, i) );
+        Gia_LevObjForEachFaninId( p, i, iFanin, k )
+            Vec_WecPush( p->vFanouts, iFanin, i );
+        if ( Gia_ObjIsCo(pObj) )
+            p->nLevelMax = Abc_MaxInt( p->nLevelMax, Vec_IntEntry(p->vLevels, i) );
+    }
+    p->nLevelMax += nLevelIncrease;
+    // reverse levels in the reverse topological order
+    Gia_ManForEachObjReverse( pGia, pObj, i )
+        if ( !Gia_ObjIsCo(pObj) )
+            Vec_IntWriteEntry( p->vLevelsR, i, Gia_LevObjLevelRNew(p, i) );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevManStop( Gia_LevMan_t * p )
+{
+    Vec_IntFree( p->vRepl );
+    Vec_WecFree( p->vFanouts );
+    Vec_IntFree( p->vLevels );
+    Vec_IntFree( p->vLevelsR );
+    Vec_WecFree( p->vBuckets );
+    Vec_StrFree( p->vQueued );
+    Vec_StrFree( p->vDead );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Queries the timing information.]
+
+  Description [All queries take constant time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_LevManLevelMax( Gia_LevMan_t * p )                { return p->nLevelMax;                                                     }
+void Gia_LevManSetLevelMax( Gia_LevMan_t * p, int Level ) { p->nLevelMax = Level;                                                    }
+int Gia_LevObjLevel( Gia_LevMan_t * p, int iObj )         { return Vec_IntEntry( p->vLevels, iObj );                                 }
+int Gia_LevObjLevelR( Gia_LevMan_t * p, int iObj )        { return Vec_IntEntry( p->vLevelsR, iObj );                                }
+int Gia_LevObjRequired( Gia_LevMan_t * p, int iObj )      { return p->nLevelMax - Vec_IntEntry( p->vLevelsR, iObj );                 }
+int Gia_LevObjSlack( Gia_LevMan_t * p, int iObj )         { return Gia_LevObjRequired( p, iObj ) - Vec_IntEntry( p->vLevels, iObj ); }
+int Gia_LevObjIsDead( Gia_LevMan_t * p, int iObj )        { return Vec_StrEntry( p->vDead, iObj );                                   }
+int Gia_LevLitRepr( Gia_LevMan_t * p, int iLit )          { Gia_LevManAppend( p ); return Gia_LevLitResolve( p, iLit );             }
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the largest level of the COs.]
+
+  Description [Takes time proportional to the number of COs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_LevManCoLevelMax( Gia_LevMan_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, LevelMax = 0;
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        LevelMax = Abc_MaxInt( LevelMax, Vec_IntEntry(p->vLevels, Gia_ObjId(p->pGia, pObj)) );
+    return LevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Schedules the object for recomputation.]
+
+  Description [Objects are stored in the buckets by their old levels.
+  Since the old levels are consistent, processing the buckets in the
+  increasing order guarantees that the fanins (for levels) or fanouts
+  (for reverse levels) of an object are processed before the object.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_LevManSchedule( Gia_LevMan_t * p, int iObj, int Level, int * pLevelMin )
+{
+    if ( Vec_StrEntry(p->vQueued, iObj) )
+        return;
+    Vec_StrWriteEntry( p->vQueued, iObj, 1 );
+    Vec_WecPush( p->vBuckets, Level, iObj );
+    *pLevelMin = Abc_MinInt( *pLevelMin, Level );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the levels from the scheduled objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManPropagate( Gia_LevMan_t * p, int LevelMin )
+{
+    int Lev, k, m, iObj, iFanout, LevelOld, LevelNew;
+    for ( Lev = LevelMin; Lev < Vec_WecSize(p->vBuckets); Lev++ )
+    {
+        // the bucket may grow while it is processed (buffers have zero delay)
+        for ( k = 0; k < Vec_IntSize(Vec_WecEntry(p->vBuckets, Lev)); k++ )
+        {
+            iObj = Vec_IntEntry( Vec_WecEntry(p->vBuckets, Lev), k );
+            Vec_StrWriteEntry( p->vQueued, iObj, 0 );
+            LevelOld = Vec_IntEntry( p->vLevels, iObj );
+            LevelNew = Gia_LevObjLevelNew( p, iObj );
+            p->nUpdates++;
+            if ( LevelOld == LevelNew )
+                continue;
+            Vec_IntWriteEntry( p->vLevels, iObj, LevelNew );
+            Vec_IntForEachEntry( Vec_WecEntry(p->vFanouts, iObj), iFanout, m )
+                if ( !Vec_StrEntry(p->vQueued, iFanout) )
+                {
+                    assert( Vec_IntEntry(p->vLevels, iFanout) >= Lev );
+                    Vec_StrWriteEntry( p->vQueued, iFanout, 1 );
+                    Vec_WecPush( p->vBuckets, Vec_IntEntry(p->vLevels, iFanout), iFanout );
+                }
+        }
+        Vec_IntClear( Vec_WecEntry(p->vBuckets, Lev) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the reverse levels from the scheduled objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManPropagateR( Gia_LevMan_t * p, int LevelMin )
+{
+    int Lev, k, m, iObj, iFanin, LevelOld, LevelNew;
+    for ( Lev = LevelMin; Lev < Vec_WecSize(p->vBuckets); Lev++ )
+    {
+        for ( k = 0; k < Vec_IntSize(Vec_WecEntry(p->vBuckets, Lev)); k++ )
+        {
+            iObj = Vec_IntEntry( Vec_WecEntry(p->vBuckets, Lev), k );
+            Vec_StrWriteEntry( p->vQueued, iObj, 0 );
+            LevelOld = Vec_IntEntry( p->vLevelsR, iObj );
+            LevelNew = Gia_LevObjLevelRNew( p, iObj );
+            p->nUpdates++;
+            if ( LevelOld == LevelNew )
+                continue;
+            Vec_IntWriteEntry( p->vLevelsR, iObj, LevelNew );
+            Gia_LevObjForEachFaninId( p, iObj, iFanin, m )
+                if ( !Vec_StrEntry(p->vQueued, iFanin) )
+                {
+                    assert( Vec_IntEntry(p->vLevelsR, iFanin) >= Lev );
+                    Vec_StrWriteEntry( p->vQueued, iFanin, 1 );
+                    Vec_WecPush( p->vBuckets, Vec_IntEntry(p->vLevelsR, iFanin), iFanin );
+                }
+        }
+        Vec_IntClear( Vec_WecEntry(p->vBuckets, Lev) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the node left without fanouts by an earlier replacement.]
+
+  Description [Adds the node and its removed fanins back to the fanout
+  lists, recomputes their levels, and collects them in a topological
+  order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManRevive_rec( Gia_LevMan_t * p, int iObj, Vec_Int_t * vRevived )
+{
+    int k, iFanin;
+    assert( Vec_StrEntry(p->vDead, iObj) );
+    Vec_StrWriteEntry( p->vDead, iObj, 0 );
+    Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+    {
+        if ( Vec_StrEntry(p->vDead, iFanin) )
+            Gia_LevManRevive_rec( p, iFanin, vRevived );
+        Vec_WecPush( p->vFanouts, iFanin, iObj );
+    }
+    Vec_IntWriteEntry( p->vLevels, iObj, Gia_LevObjLevelNew(p, iObj) );
+    Vec_IntPush( vRevived, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reverse levels of the restored nodes.]
+
+  Description [All fanouts of the restored nodes are either restored
+  nodes or nodes with final reverse levels, so the reverse levels are
+  computed directly. The remaining fanins are scheduled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManReviveFinish( Gia_LevMan_t * p, Vec_Int_t * vRevived, int * pLevelMin )
+{
+    int i, k, iObj, iFanin;
+    Vec_IntForEachEntryReverse( vRevived, iObj, i )
+        Vec_IntWriteEntry( p->vLevelsR, iObj, Gia_LevObjLevelRNew(p, iObj) );
+    Vec_IntForEachEntry( vRevived, iObj, i )
+        Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+            Gia_LevManSchedule( p, iFanin, Vec_IntEntry(p->vLevelsR, iFanin), pLevelMin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Registers the nodes appended to the AIG since the last call.]
+
+  Description [The new nodes get their levels and are added to the fanout
+  lists of their fanins. They have no fanouts, so their reverse levels
+  are 0, but they may increase the reverse levels of their fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevManAppend( Gia_LevMan_t * p )
+{
+    Vec_Int_t * vRevived;
+    int i, k, iFanin, iStart = Vec_IntSize( p->vLevels ), LevelMin = ABC_INFINITY;
+    if ( iStart == Gia_ManObjNum(p->pGia) )
+        return;
+    Gia_LevManExtend( p );
+    vRevived = Vec_IntAlloc( 16 );
+    for ( i = iStart; i < Gia_ManObjNum(p->pGia); i++ )
+    {
+        assert( Gia_ObjIsAnd(Gia_ManObj(p->pGia, i)) );
+        Gia_LevObjForEachFaninId( p, i, iFanin, k )
+        {
+            if ( Vec_StrEntry(p->vDead, iFanin) )
+                Gia_LevManRevive_rec( p, iFanin, vRevived );
+            Vec_WecPush( p->vFanouts, iFanin, i );
+            if ( iFanin < iStart )
+                Gia_LevManSchedule( p, iFanin, Vec_IntEntry(p->vLevelsR, iFanin), &LevelMin );
+        }
+        Vec_IntWriteEntry( p->vLevels, i, Gia_LevObjLevelNew(p, i) );
+    }
+    for ( i = Gia_ManObjNum(p->pGia) - 1; i >= iStart; i-- )
+        Vec_IntWriteEntry( p->vLevelsR, i, Gia_LevObjLevelRNew(p, i) );
+    Gia_LevManReviveFinish( p, vRevived, &LevelMin );
+    Vec_IntFree( vRevived );
+    if ( LevelMin < ABC_INFINITY )
+        Gia_LevManPropagateR( p, LevelMin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the node without fanouts from the fanout lists.]
+
+  Description [Schedules the fanins whose reverse levels may change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManRemove_rec( Gia_LevMan_t * p, int iObj, int * pLevelMin )
+{
+    int k, iFanin;
+    assert( Vec_IntSize(Vec_WecEntry(p->vFanouts, iObj)) == 0 );
+    Vec_StrWriteEntry( p->vDead, iObj, 1 );
+    Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+    {
+        Vec_IntRemove( Vec_WecEntry(p->vFanouts, iFanin), iObj );
+        if ( Vec_IntSize(Vec_WecEntry(p->vFanouts, iFanin)) == 0 && Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFanin)) )
+            Gia_LevManRemove_rec( p, iFanin, pLevelMin );
+        else
+            Gia_LevManSchedule( p, iFanin, Vec_IntEntry(p->vLevelsR, iFanin), pLevelMin );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by the literal.]
+
+  Description [The fanouts of the node are redirected to the literal.
+  The node and the part of its fanin cone, which is left without fanouts,
+  are removed from the fanout lists. The levels of the transitive fanout
+  and the reverse levels of the affected transitive fanin are updated
+  by propagating the changes through the bucket queue. Only the objects
+  whose levels change and their immediate neighbors are visited. The
+  literal should not depend on the node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevManReplace( Gia_LevMan_t * p, int iObj, int iLitNew )
+{
+    Vec_Int_t * vFanouts, * vRevived = NULL;
+    int k, iFanout, iObjNew, LevelMin = ABC_INFINITY;
+    Gia_LevManAppend( p );
+    iLitNew = Gia_LevLitResolve( p, iLitNew );
+    iObjNew = Abc_Lit2Var( iLitNew );
+    assert( Gia_ObjIsAnd(Gia_ManObj(p->pGia, iObj)) );
+    assert( iObjNew != iObj && Vec_IntEntry(p->vRepl, iObj) == -1 );
+    Vec_IntWriteEntry( p->vRepl, iObj, iLitNew );
+    // restore the literal if it was left without fanouts
+    if ( Vec_StrEntry(p->vDead, iObjNew) )
+    {
+        vRevived = Vec_IntAlloc( 16 );
+        Gia_LevManRevive_rec( p, iObjNew, vRevived );
+    }
+    // move the fanouts
+    vFanouts = Vec_WecEntry( p->vFanouts, iObj );
+    Vec_IntForEachEntry( vFanouts, iFanout, k )
+        Vec_WecPush( p->vFanouts, iObjNew, iFanout );
+    // update the levels of the fanouts
+    vFanouts = Vec_WecEntry( p->vFanouts, iObj );
+    Vec_IntForEachEntry( vFanouts, iFanout, k )
+        Gia_LevManSchedule( p, iFanout, Vec_IntEntry(p->vLevels, iFanout), &LevelMin );
+    Vec_IntClear( vFanouts );
+    if ( LevelMin < ABC_INFINITY )
+        Gia_LevManPropagate( p, LevelMin );
+    // update the reverse levels of the fanin cones
+    LevelMin = ABC_INFINITY;
+    if ( vRevived )
+    {
+        Gia_LevManReviveFinish( p, vRevived, &LevelMin );
+        Vec_IntFree( vRevived );
+    }
+    else
+        Gia_LevManSchedule( p, iObjNew, Vec_IntEntry(p->vLevelsR, iObjNew), &LevelMin );
+    Gia_LevManRemove_rec( p, iObj, &LevelMin );
+    if ( LevelMin < ABC_INFINITY )
+        Gia_LevManPropagateR( p, LevelMin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies the levels and reverse levels.]
+
+  Description [Recomputes both from scratch through the replacement map
+  and reports the mismatches. Returns 1 if there are no mismatches.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevManCollect_rec( Gia_LevMan_t * p, int iObj, Vec_Str_t * vVisited, Vec_Int_t * vOrder )
+{
+    int k, iFanin;
+    if ( Vec_StrEntry(vVisited, iObj) )
+        return;
+    Vec_StrWriteEntry( vVisited, iObj, 1 );
+    Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+        Gia_LevManCollect_rec( p, iFanin, vVisited, vOrder );
+    Vec_IntPush( vOrder, iObj );
+}
+int Gia_LevManVerify( Gia_LevMan_t * p, int fVerbose )
+{
+    Vec_Str_t * vVisited;
+    Vec_Int_t * vOrder, * vLevels, * vLevelsR;
+    Gia_Obj_t * pObj;
+    int i, k, iObj, iFanin, Delay, nErrors = 0, nErrorsR = 0;
+    Gia_LevManAppend( p );
+    vVisited = Vec_StrStart( Gia_ManObjNum(p->pGia) );
+    vOrder   = Vec_IntAlloc( Gia_ManObjNum(p->pGia) );
+    vLevels  = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    vLevelsR = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    // the live objects in a topological order
+    Gia_ManForEachObj( p->pGia, pObj, i )
+        if ( !Vec_StrEntry(p->vDead, i) )
+            Gia_LevManCollect_rec( p, i, vVisited, vOrder );
+    Vec_IntForEachEntry( vOrder, iObj, i )
+    {
+        Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+            Vec_IntUpdateEntry( vLevels, iObj, Vec_IntEntry(vLevels, iFanin) );
+        Vec_IntAddToEntry( vLevels, iObj, Gia_LevObjDelay(p, Gia_ManObj(p->pGia, iObj)) );
+    }
+    Vec_IntForEachEntryReverse( vOrder, iObj, i )
+    {
+        pObj = Gia_ManObj( p->pGia, iObj );
+        if ( Gia_ObjIsCo(pObj) )
+            continue;
+        Delay = Gia_LevObjDelay( p, pObj );
+        Gia_LevObjForEachFaninId( p, iObj, iFanin, k )
+            Vec_IntUpdateEntry( vLevelsR, iFanin, Vec_IntEntry(vLevelsR, iObj) + Delay );
+    }
+    Vec_IntForEachEntry( vOrder, iObj, i )
+    {
+        if ( Vec_IntEntry(vLevels, iObj) != Vec_IntEntry(p->vLevels, iObj) )
+        {
+            if ( fVerbose && nErrors < 5 )
+                printf( "Level of object %d is %d instead of %d.\n", iObj, Vec_IntEntry(p->vLevels, iObj), Vec_IntEntry(vLevels, iObj) );
+            nErrors++;
+        }
+        if ( Gia_ObjIsCo(Gia_ManObj(p->pGia, iObj)) )
+            continue;
+        if ( Vec_IntEntry(vLevelsR, iObj) != Vec_IntEntry(p->vLevelsR, iObj) )
+        {
+            if ( fVerbose && nErrorsR < 5 )
+                printf( "Reverse level of object %d is %d instead of %d.\n", iObj, Vec_IntEntry(p->vLevelsR, iObj), Vec_IntEntry(vLevelsR, iObj) );
+            nErrorsR++;
+        }
+    }
+    if ( fVerbose )
+        printf( "Checked %d live objects: %d level and %d reverse level mismatches (%d updates).\n",
+            Vec_IntSize(vOrder), nErrors, nErrorsR, p->nUpdates );
+    Vec_StrFree( vVisited );
+    Vec_IntFree( vOrder );
+    Vec_IntFree( vLevels );
+    Vec_IntFree( vLevelsR );
+    return nErrors == 0 && nErrorsR == 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -60,7 +60,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     assert( nObjsMax > 0 );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    p->pObjs = Gia_ManPoolObjsAlloc( nObjsMax );
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -153,8 +153,8 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    Gia_ManPoolIntsRecycle( &p->vHash );
+    Gia_ManPoolIntsRecycle( &p->vHTable );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
     ABC_FREE( p->pTravIds );
@@ -172,7 +172,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    Gia_ManPoolObjsRecycle( p->pObjs, p->nObjsAlloc );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -31,6 +31,17 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -41,7 +52,11 @@ ABC_NAMESPACE_IMPL_START
 #define NF_CUT_MAX  32
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
+#define NF_NEW_FUNC 0x1FFFFFE    // the function is not in the table yet
 #define NF_EPSILON  0.001
+#define NF_THR_MAX   100
+#define NF_PAR_MIN    64     // the smallest level processed by the threads
+#define NF_PAR_CHUNK 4096     // the number of nodes whose cuts are buffered
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -53,6 +68,7 @@ struct Nf_Cut_t_
     unsigned        Useless :  1;   // function
     unsigned        nLeaves :  5;   // leaf number (NF_NO_LEAF)
     int             pLeaves[NF_LEAF_MAX+1]; // leaves
+    word            Truth;          // function (NF_NEW_FUNC)
 };
 typedef struct Nf_Cfg_t_ Nf_Cfg_t; 
 struct Nf_Cfg_t_
@@ -98,6 +114,12 @@ struct Nf_Man_t_
     Vec_Flt_t       vCutFlows;      // temporary cut area
     Vec_Int_t       vCutDelays;     // temporary cut delay
     Vec_Int_t       vBackup;        // backup literals
+    Vec_Wec_t *     vMatchLevs;     // objects by level for concurrent matching
+    void *          pPar;           // concurrent threads
+    int             fCutsPar;       // the cuts are computed concurrently
+    int             iCutsBase;      // the first object of the buffered cuts
+    Nf_Cut_t *      pCutsBuf;       // the buffered cuts
+    int *           pCutsBufNum;    // the number of buffered cuts
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
@@ -424,6 +446,7 @@ void Nf_StoDelete( Nf_Man_t * p )
     ABC_FREE( p->vCutDelays.pArray );
     ABC_FREE( p->vBackup.pArray );
     ABC_FREE( p->pNfObjs );
+    Vec_WecFreeP( &p->vMatchLevs );
     ABC_FREE( p );
 }
 
@@ -441,6 +464,18 @@ void Nf_StoDelete( Nf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Nf_CutTruthId( Nf_Man_t * p, word * pTruth, Nf_Cut_t * pCutR )
+{
+    int truthId;
+    if ( !p->fCutsPar )
+        return Vec_MemHashInsert(p->vTtMem, pTruth);
+    // the table is read-only for the threads; new functions are added later
+    truthId = *Vec_MemHashLookup(p->vTtMem, pTruth);
+    if ( truthId >= 0 )
+        return truthId;
+    pCutR->Truth = *pTruth;
+    return NF_NEW_FUNC;
+}
 static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, int fCompl0, int fCompl1, Nf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Nf_ManTruthCanonicize( word * t, int nVars );
@@ -455,7 +490,7 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_CutTruthId(p, &t, pCutR);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -477,7 +512,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_CutTruthId(p, &t, pCutR);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -852,9 +887,9 @@ static inline void Nf_CutParams( Nf_Man_t * p, Nf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Nf_CutArea(p, nLeaves)) / FlowRefs;
 }
-void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
+static inline int Nf_ObjMergeOrderInt( Nf_Man_t * p, int iObj, Nf_Cut_t * pCuts, Nf_Cut_t ** pCutsR, double * pCutCount )
 {
-    Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX], pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
+    Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
     //Nf_Obj_t * pBest = Nf_ManObj(p, iObj);
     float dFlowRefs  = Nf_ObjFlowRefs(p, iObj, 0) + Nf_ObjFlowRefs(p, iObj, 1);
@@ -866,7 +901,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     int fComp1   = Gia_ObjFaninC1(pObj);
     int iSibl    = Gia_ObjSibl(p->pGia, iObj);
     Nf_Cut_t * pCut0, * pCut1, * pCut0Lim = pCuts0 + nCuts0, * pCut1Lim = pCuts1 + nCuts1;
-    int i, nCutsUse, nCutsR = 0;
+    int i, nCutsR = 0;
     assert( !Gia_ObjIsBuf(pObj) );
     for ( i = 0; i < nCutNum; i++ )
         pCutsR[i] = pCuts + i;
@@ -891,19 +926,19 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
         int nCuts2  = Nf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Nf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        pCutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Nf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pCutCount[1]++; 
             if ( !Nf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            pCutCount[2]++;
             if ( Nf_CutComputeTruthMux6(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
@@ -913,18 +948,18 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
+        pCutCount[0] += nCuts0 * nCuts1;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         {
             if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Nf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            pCutCount[1]++; 
             if ( !Nf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Nf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            pCutCount[2]++;
             if ( Nf_CutComputeTruth6(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Nf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Nf_CutParams( p, pCutsR[nCutsR], dFlowRefs );
@@ -944,6 +979,19 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Nf_SetCheckArray(pCutsR, nCutsR) );
+    return nCutsR;
+}
+static inline void Nf_ObjSaveCutSet( Nf_Man_t * p, int iObj, Nf_Cut_t ** pCutsR, int nCutsR )
+{
+    int i, nCutsUse;
+    // add the new functions
+    for ( i = 0; i < nCutsR; i++ )
+        if ( Abc_Lit2Var(pCutsR[i]->iFunc) == NF_NEW_FUNC )
+        {
+            int truthId = Vec_MemHashInsert( p->vTtMem, &pCutsR[i]->Truth );
+            assert( pCutsR[i]->Useless && Nf_ObjCutUseless(p, truthId) );
+            pCutsR[i]->iFunc = Abc_Var2Lit( truthId, Abc_LitIsCompl(pCutsR[i]->iFunc) );
+        }
     // store the cutset
     Nf_ObjSetCutFlow( p, iObj, pCutsR[0]->Flow );
     Nf_ObjSetCutDelay( p, iObj, pCutsR[0]->Delay );
@@ -954,9 +1002,21 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     p->nCutUseAll  += nCutsUse == nCutsR;
     p->CutCount[5] += Nf_ManCountMatches(p, pCutsR, nCutsR);
 }
+void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
+{
+    Nf_Cut_t pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
+    int nCutsR = Nf_ObjMergeOrderInt( p, iObj, pCuts, pCutsR, p->CutCount );
+    Nf_ObjSaveCutSet( p, iObj, pCutsR, nCutsR );
+}
 void Nf_ManComputeCuts( Nf_Man_t * p )
 {
+    extern void Nf_ManComputeCutsPar( Nf_Man_t * p );
     Gia_Obj_t * pObj; int i, iFanin;
+    if ( p->pPars->nProcNum > 1 )
+    {
+        Nf_ManComputeCutsPar( p );
+        return;
+    }
     Gia_ManForEachAnd( p->pGia, pObj, i )
         if ( Gia_ObjIsBuf(pObj) )
         {
@@ -1382,9 +1442,332 @@ void Nf_ManCutMatch( Nf_Man_t * p, int iObj )
     }
 */
 }
+static inline void Nf_ManMatchRange( Nf_Man_t * p, Vec_Int_t * vObjs, int iStart, int iStop )
+{
+    Gia_Obj_t * pObj; int i;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Gia_ManObj( p->pGia, Vec_IntEntry(vObjs, i) );
+        if ( Gia_ObjIsBuf(pObj) )
+            Nf_ObjPrepareBuf( p, pObj );
+        else
+            Nf_ManCutMatch( p, Vec_IntEntry(vObjs, i) );
+    }
+}
+static inline void Nf_ManCutRange( Nf_Man_t * p, Vec_Int_t * vObjs, int iStart, int iStop, double * pCutCount )
+{
+    Nf_Cut_t pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
+    int i, k, nCutsR, iObj;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        iObj = Vec_IntEntry( vObjs, i );
+        if ( Gia_ObjIsBuf(Gia_ManObj(p->pGia, iObj)) )
+            continue;
+        nCutsR = Nf_ObjMergeOrderInt( p, iObj, pCuts, pCutsR, pCutCount );
+        for ( k = 0; k < nCutsR; k++ )
+            p->pCutsBuf[(i - p->iCutsBase) * p->pPars->nCutNum + k] = *pCutsR[k];
+        p->pCutsBufNum[i - p->iCutsBase] = nCutsR;
+    }
+}
+static inline void Nf_ManRunRange( Nf_Man_t * p, Vec_Int_t * vObjs, int iStart, int iStop, int fCuts, double * pCutCount )
+{
+    if ( fCuts )
+        Nf_ManCutRange( p, vObjs, iStart, iStop, pCutCount );
+    else
+        Nf_ManMatchRange( p, vObjs, iStart, iStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the nodes by levels.]
+
+  Description [Computing the cuts of a node reads the cuts of its fanins 
+  and its choice node. Matching a node reads the matches and the required 
+  times of the leaves of its cuts. In both cases, only the data of the node
+  is written, so the nodes of the same level are processed independently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Nf_ManLevelize( Nf_Man_t * p, int fCuts )
+{
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vObjLevs = Vec_IntStart( Gia_ManObjNum(p->pGia) );
+    Gia_Obj_t * pObj; int i, k, v, * pCut, * pCutSet, Level;
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        if ( Gia_ObjIsBuf(pObj) )
+            Level = Vec_IntEntry( vObjLevs, Gia_ObjFaninId0(pObj, i) );
+        else if ( fCuts )
+        {
+            Level = Abc_MaxInt( Vec_IntEntry(vObjLevs, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vObjLevs, Gia_ObjFaninId1(pObj, i)) );
+            if ( Gia_ObjIsMuxId(p->pGia, i) )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vObjLevs, Gia_ObjFaninId2(p->pGia, i)) );
+            if ( Gia_ObjSibl(p->pGia, i) )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vObjLevs, Gia_ObjSibl(p->pGia, i)) );
+        }
+        else
+        {
+            Level = 0;
+            pCutSet = Nf_ObjCutSet( p, i );
+            Nf_SetForEachCut( pCutSet, pCut, k )
+                for ( v = 0; v < Nf_CutSize(pCut); v++ )
+                    Level = Abc_MaxInt( Level, Vec_IntEntry(vObjLevs, Nf_CutLeaves(pCut)[v]) );
+        }
+        Vec_IntWriteEntry( vObjLevs, i, ++Level );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vObjLevs );
+    return vLevels;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+static void Nf_ManParStart( Nf_Man_t * p ) {}
+static void Nf_ManParStop( Nf_Man_t * p )  {}
+static void Nf_ManParRange( Nf_Man_t * p, Vec_Int_t * vObjs, int iStart, int iStop, int fCuts )
+{
+    Nf_ManRunRange( p, vObjs, iStart, iStop, fCuts, p->CutCount );
+}
+
+#else // pthreads are used
+
+typedef struct Nf_Par_t_ Nf_Par_t;
+
+typedef struct Nf_ThData_t_ Nf_ThData_t;
+struct Nf_ThData_t_
+{
+    Nf_Par_t *       pPar;           // thread manager
+    int              iStart;         // the first object of this thread
+    int              iStop;          // the last object of this thread
+    double           CutCount[3];    // cut counts
+};
+
+struct Nf_Par_t_
+{
+    Nf_Man_t *       p;              // mapping manager
+    int              nProcs;         // the number of threads, including this one
+    Vec_Int_t *      vObjs;          // objects of the current level
+    int              fCuts;          // computing cuts or matching
+    int              iRound;         // the number of ranges given to the threads
+    int              nBusy;          // the number of threads processing the current range
+    int              fStop;          // the threads should exit
+    pthread_mutex_t  Mutex;          // protects the fields above
+    pthread_cond_t   CondStart;      // signals a new range or the stop
+    pthread_cond_t   CondDone;       // signals that the last thread is done
+    Nf_ThData_t      ThData[NF_THR_MAX];
+    pthread_t        WorkerThread[NF_THR_MAX];
+};
+
+void * Nf_WorkerThread( void * pArg )
+{
+    Nf_ThData_t * pThData = (Nf_ThData_t *)pArg;
+    Nf_Par_t * pPar = pThData->pPar;
+    int iRound = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( pPar->iRound == iRound && !pPar->fStop )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        iRound = pPar->iRound;
+        pthread_mutex_unlock( &pPar->Mutex );
+        if ( pPar->fStop )
+            return NULL;
+        Nf_ManRunRange( pPar->p, pPar->vObjs, pThData->iStart, pThData->iStop, pPar->fCuts, pThData->CutCount );
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+static void Nf_ManParStart( Nf_Man_t * p )
+{
+    Nf_Par_t * pPar = ABC_CALLOC( Nf_Par_t, 1 );
+    int i, status;
+    assert( p->pPar == NULL );
+    pPar->p      = p;
+    pPar->nProcs = Abc_MinInt( p->pPars->nProcNum, NF_THR_MAX );
+    status = pthread_mutex_init( &pPar->Mutex, NULL );        assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondStart, NULL );     assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondDone, NULL );      assert( status == 0 );
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        pPar->ThData[i].pPar = pPar;
+        status = pthread_create( pPar->WorkerThread + i, NULL, Nf_WorkerThread, (void *)(pPar->ThData + i) );  assert( status == 0 );
+    }
+    p->pPar = pPar;
+}
+static void Nf_ManParStop( Nf_Man_t * p )
+{
+    Nf_Par_t * pPar = (Nf_Par_t *)p->pPar;
+    int i, k, status;
+    pthread_mutex_lock( &pPar->Mutex );
+    assert( pPar->nBusy == 0 );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        status = pthread_join( pPar->WorkerThread[i], NULL );  assert( status == 0 );
+        for ( k = 0; k < 3; k++ )
+            p->CutCount[k] += pPar->ThData[i].CutCount[k];
+    }
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    ABC_FREE( pPar );
+    p->pPar = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the range of objects of one level.]
+
+  Description [Splits the objects among the threads. Small ranges are
+  processed by this thread. Between the ranges, the threads wait on 
+  the condition variable.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Nf_ManParRange( Nf_Man_t * p, Vec_Int_t * vObjs, int iStart, int iStop, int fCuts )
+{
+    Nf_Par_t * pPar = (Nf_Par_t *)p->pPar;
+    int i, nObjs = iStop - iStart, nProcs, nChunk;
+    if ( nObjs < NF_PAR_MIN )
+    {
+        Nf_ManRunRange( p, vObjs, iStart, iStop, fCuts, p->CutCount );
+        return;
+    }
+    nProcs = Abc_MinInt( pPar->nProcs, nObjs / (NF_PAR_MIN / 2) );
+    nChunk = (nObjs + nProcs - 1) / nProcs;
+    // give the ranges to the threads (the extra threads get empty ranges)
+    pthread_mutex_lock( &pPar->Mutex );
+    assert( pPar->nBusy == 0 );
+    pPar->vObjs = vObjs;
+    pPar->fCuts = fCuts;
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        Nf_ThData_t * pThData = pPar->ThData + i;
+        pThData->iStart = iStart + Abc_MinInt( i * nChunk, nObjs );
+        pThData->iStop  = i < nProcs ? iStart + Abc_MinInt( (i + 1) * nChunk, nObjs ) : pThData->iStart;
+    }
+    pPar->nBusy = pPar->nProcs - 1;
+    pPar->iRound++;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    // process the first range here
+    Nf_ManRunRange( p, vObjs, iStart, iStart + Abc_MinInt(nChunk, nObjs), fCuts, p->CutCount );
+    // wait till the threads finish
+    pthread_mutex_lock( &pPar->Mutex );
+    while ( pPar->nBusy > 0 )
+        pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+    pthread_mutex_unlock( &pPar->Mutex );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts level by level using concurrent threads.]
+
+  Description [The threads do not add functions to the truth table store.
+  The new functions are added when the cuts are saved by this thread, in
+  the order of the nodes. The cuts are the same as those computed by 
+  Nf_ManComputeCuts(), except for the IDs of the functions not in the 
+  library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ManComputeCutsPar( Nf_Man_t * p )
+{
+    Nf_Cut_t * pCutsR[NF_CUT_MAX];
+    Vec_Wec_t * vLevels = Nf_ManLevelize( p, 1 );
+    Vec_Int_t * vLevel;
+    Gia_Obj_t * pObj;
+    int i, k, c, iObj, iStop;
+    p->pCutsBuf    = ABC_ALLOC( Nf_Cut_t, NF_PAR_CHUNK * p->pPars->nCutNum );
+    p->pCutsBufNum = ABC_ALLOC( int, NF_PAR_CHUNK );
+    p->fCutsPar    = 1;
+    Nf_ManParStart( p );
+    Vec_WecForEachLevelStart( vLevels, vLevel, k, 1 )
+    for ( p->iCutsBase = 0; p->iCutsBase < Vec_IntSize(vLevel); p->iCutsBase = iStop )
+    {
+        iStop = Abc_MinInt( p->iCutsBase + NF_PAR_CHUNK, Vec_IntSize(vLevel) );
+        Nf_ManParRange( p, vLevel, p->iCutsBase, iStop, 1 );
+        // save the cuts in the order of the nodes
+        for ( i = p->iCutsBase; i < iStop; i++ )
+        {
+            iObj = Vec_IntEntry( vLevel, i );
+            pObj = Gia_ManObj( p->pGia, iObj );
+            if ( Gia_ObjIsBuf(pObj) )
+            {
+                Nf_ObjSetCutFlow( p, iObj,  Nf_ObjCutFlow(p, Gia_ObjFaninId0(pObj, iObj)) );
+                Nf_ObjSetCutDelay( p, iObj, Nf_ObjCutDelay(p, Gia_ObjFaninId0(pObj, iObj)) );
+                continue;
+            }
+            for ( c = 0; c < p->pCutsBufNum[i - p->iCutsBase]; c++ )
+                pCutsR[c] = p->pCutsBuf + (i - p->iCutsBase) * p->pPars->nCutNum + c;
+            Nf_ObjSaveCutSet( p, iObj, pCutsR, p->pCutsBufNum[i - p->iCutsBase] );
+        }
+    }
+    Nf_ManParStop( p );
+    p->fCutsPar = 0;
+    ABC_FREE( p->pCutsBuf );
+    ABC_FREE( p->pCutsBufNum );
+    Vec_WecFree( vLevels );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the nodes level by level using concurrent threads.]
+
+  Description [The result is the same as that of Nf_ManComputeMapping().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ManComputeMappingPar( Nf_Man_t * p )
+{
+    Vec_Int_t * vLevel; int k;
+    if ( p->vMatchLevs == NULL )
+        p->vMatchLevs = Nf_ManLevelize( p, 0 );
+    Nf_ManParStart( p );
+    Vec_WecForEachLevelStart( p->vMatchLevs, vLevel, k, 1 )
+        Nf_ManParRange( p, vLevel, 0, Vec_IntSize(vLevel), 0 );
+    Nf_ManParStop( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Matches the nodes in the topological order.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Nf_ManComputeMapping( Nf_Man_t * p )
 {
     Gia_Obj_t * pObj; int i;
+    if ( p->pPars->nProcNum > 1 )
+    {
+        Nf_ManComputeMappingPar( p );
+        return;
+    }
     Gia_ManForEachAnd( p->pGia, pObj, i )
         if ( Gia_ObjIsBuf(pObj) )
             Nf_ObjPrepareBuf( p, pObj );
@@ -0,0 +1,243 @@
+/**CFile****************************************************************
+
+  FileName    [giaPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Recycling object arrays and hash tables of AIG managers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaPool.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Scripts, such as "&dc2; &if; &mfs", create a new manager with each
+// duplication and delete the old one right after. The large arrays of the
+// deleted manager are kept here and handed to the next manager of a similar
+// size, which saves the page faults of touching freshly allocated memory.
+
+#define GIA_POOL_SIZE   4           // the number of blocks of each kind
+#define GIA_POOL_MIN    (1 << 16)   // the smallest block worth keeping
+
+typedef struct Gia_PoolBlk_t_ Gia_PoolBlk_t;
+struct Gia_PoolBlk_t_
+{
+    void *           pArray;        // the memory block
+    int              nCap;          // the number of entries
+};
+
+typedef struct Gia_Pool_t_ Gia_Pool_t;
+struct Gia_Pool_t_
+{
+    Gia_PoolBlk_t    pObjs[GIA_POOL_SIZE];  // blocks of AIG objects
+    Gia_PoolBlk_t    pInts[GIA_POOL_SIZE];  // blocks of integers (hash tables)
+};
+
+static Gia_Pool_t s_GiaPool;
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_GiaPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Gia_PoolLock()   { int status = pthread_mutex_lock(&s_GiaPoolMutex);   assert( status == 0 ); (void)status; }
+static inline void Gia_PoolUnlock() { int status = pthread_mutex_unlock(&s_GiaPoolMutex); assert( status == 0 ); (void)status; }
+#else
+static inline void Gia_PoolLock()   {}
+static inline void Gia_PoolUnlock() {}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the best-fitting block from the pool.]
+
+  Description [Returns a block with at least nSize and at most 2*nSize
+  entries, or NULL if there is no such block.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_PoolFetch( Gia_PoolBlk_t * pBlks, int nSize, int * pnCap )
+{
+    void * pArray = NULL;
+    int i, iBest = -1;
+    if ( nSize < GIA_POOL_MIN )
+        return NULL;
+    Gia_PoolLock();
+    for ( i = 0; i < GIA_POOL_SIZE; i++ )
+        if ( pBlks[i].pArray && pBlks[i].nCap >= nSize && pBlks[i].nCap / 2 <= nSize )
+            if ( iBest == -1 || pBlks[iBest].nCap > pBlks[i].nCap )
+                iBest = i;
+    if ( iBest >= 0 )
+    {
+        pArray = pBlks[iBest].pArray;
+        *pnCap = pBlks[iBest].nCap;
+        pBlks[iBest].pArray = NULL;
+        pBlks[iBest].nCap = 0;
+    }
+    Gia_PoolUnlock();
+    return pArray;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the block to the pool or frees it.]
+
+  Description [If the pool is full, the smallest block is freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_PoolRecycle( Gia_PoolBlk_t * pBlks, void * pArray, int nCap )
+{
+    int i, iMin = 0;
+    if ( pArray == NULL )
+        return;
+    if ( nCap < GIA_POOL_MIN )
+    {
+        ABC_FREE( pArray );
+        return;
+    }
+    Gia_PoolLock();
+    for ( i = 0; i < GIA_POOL_SIZE; i++ )
+    {
+        if ( pBlks[i].pArray == NULL )
+        {
+            iMin = i;
+            break;
+        }
+        if ( pBlks[iMin].nCap > pBlks[i].nCap )
+            iMin = i;
+    }
+    if ( pBlks[iMin].pArray && pBlks[iMin].nCap > nCap )
+        ABC_FREE( pArray );
+    else
+    {
+        ABC_FREE( pBlks[iMin].pArray );
+        pBlks[iMin].pArray = pArray;
+        pBlks[iMin].nCap = nCap;
+    }
+    Gia_PoolUnlock();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates zeroed object array of the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Obj_t * Gia_ManPoolObjsAlloc( int nObjs )
+{
+    int nCap;
+    Gia_Obj_t * pObjs = (Gia_Obj_t *)Gia_PoolFetch( s_GiaPool.pObjs, nObjs, &nCap );
+    if ( pObjs == NULL )
+        return ABC_CALLOC( Gia_Obj_t, nObjs );
+    memset( pObjs, 0, sizeof(Gia_Obj_t) * nObjs );
+    return pObjs;
+}
+void Gia_ManPoolObjsRecycle( Gia_Obj_t * pObjs, int nObjs )
+{
+    Gia_PoolRecycle( s_GiaPool.pObjs, pObjs, nObjs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Provides the integer array for the hash table.]
+
+  Description [If the vector has no storage, takes it from the pool.
+  The entries are not initialized.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManPoolIntsGrow( Vec_Int_t * v, int nSize )
+{
+    int nCap, * pArray;
+    if ( v->pArray != NULL )
+        return;
+    pArray = (int *)Gia_PoolFetch( s_GiaPool.pInts, nSize, &nCap );
+    if ( pArray == NULL )
+        return;
+    v->pArray = pArray;
+    v->nCap   = nCap;
+    v->nSize  = 0;
+}
+void Gia_ManPoolIntsRecycle( Vec_Int_t * v )
+{
+    Gia_PoolRecycle( s_GiaPool.pInts, v->pArray, v->nCap );
+    v->pArray = NULL;
+    v->nSize  = 0;
+    v->nCap   = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the pooled memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManPoolQuit()
+{
+    int i;
+    Gia_PoolLock();
+    for ( i = 0; i < GIA_POOL_SIZE; i++ )
+    {
+        ABC_FREE( s_GiaPool.pObjs[i].pArray );
+        ABC_FREE( s_GiaPool.pInts[i].pArray );
+        s_GiaPool.pObjs[i].nCap = 0;
+        s_GiaPool.pInts[i].nCap = 0;
+    }
+    Gia_PoolUnlock();
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -118,6 +118,7 @@ typedef struct Abc_Aig_t_       Abc_Aig_t;
 typedef struct Abc_ManTime_t_   Abc_ManTime_t;
 typedef struct Abc_ManCut_t_    Abc_ManCut_t;
 typedef struct Abc_Time_t_      Abc_Time_t;
+typedef struct Abc_Csr_t_       Abc_Csr_t;
 
 struct Abc_Time_t_
 {
@@ -227,6 +228,24 @@ struct Abc_Des_t_
     void *            pGenlib;       // the genlib library used to map this design
 };
 
+struct Abc_Csr_t_     // packed read-only view of the network
+{
+    Abc_Ntk_t *       pNtk;          // the source network
+    int               nObjs;         // the number of object IDs
+    int               nNodes;        // the number of internal nodes in the order
+    int               nFanins;       // the total number of fanins
+    int               nFanouts;      // the total number of fanouts
+    unsigned char *   pTypes;        // the object types
+    int *             pFinStart;     // the first fanin of each object (nObjs + 1)
+    int *             pFanins;       // the fanin literals
+    int *             pFoStart;      // the first fanout of each object (nObjs + 1)
+    int *             pFanouts;      // the fanout IDs
+    int *             pLevels;       // the levels
+    int *             pLevelsR;      // the reverse levels
+    int *             pOrder;        // the internal nodes in a topological order
+    char *            pArena;        // the memory block holding the arrays
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -246,6 +265,13 @@ static inline void        Abc_InfoXor( unsigned * p, unsigned * q, int nWords )
 static inline int         Abc_InfoIsOrOne( unsigned * p, unsigned * q, int nWords ){ int i; for ( i = nWords - 1; i >= 0; i-- ) if ( ~(p[i] | q[i]) ) return 0; return 1; } 
 static inline int         Abc_InfoIsOrOne3( unsigned * p, unsigned * q, unsigned * r, int nWords ){ int i; for ( i = nWords - 1; i >= 0; i-- ) if ( ~(p[i] | q[i] | r[i]) ) return 0; return 1; } 
 
+// packed view of the network
+static inline int         Abc_CsrObjFaninNum( Abc_Csr_t * p, int i )       { return p->pFinStart[i+1] - p->pFinStart[i];   }
+static inline int         Abc_CsrObjFanoutNum( Abc_Csr_t * p, int i )      { return p->pFoStart[i+1] - p->pFoStart[i];     }
+static inline int         Abc_CsrObjFaninLit( Abc_Csr_t * p, int i, int k ){ return p->pFanins[p->pFinStart[i] + k];       }
+static inline int         Abc_CsrObjFaninId( Abc_Csr_t * p, int i, int k ) { return Abc_Lit2Var(Abc_CsrObjFaninLit(p, i, k)); }
+static inline int         Abc_CsrObjFanoutId( Abc_Csr_t * p, int i, int k ){ return p->pFanouts[p->pFoStart[i] + k];      }
+
 // checking the network type
 static inline int         Abc_NtkIsNetlist( Abc_Ntk_t * pNtk )       { return pNtk->ntkType == ABC_NTK_NETLIST;     }
 static inline int         Abc_NtkIsLogic( Abc_Ntk_t * pNtk )         { return pNtk->ntkType == ABC_NTK_LOGIC;       }
@@ -366,6 +392,7 @@ static inline void        Abc_ObjBlackboxToWhitebox( Abc_Obj_t * pObj ) { assert
 static inline int         Abc_ObjFaninNum( Abc_Obj_t * pObj )        { return pObj->vFanins.nSize;     }
 static inline int         Abc_ObjFanoutNum( Abc_Obj_t * pObj )       { return pObj->vFanouts.nSize;    }
 static inline int         Abc_ObjFaninId( Abc_Obj_t * pObj, int i)   { return pObj->vFanins.pArray[i]; }
+static inline int         Abc_ObjFanoutId( Abc_Obj_t * pObj, int i)  { return pObj->vFanouts.pArray[i]; }
 static inline int         Abc_ObjFaninId0( Abc_Obj_t * pObj )        { return pObj->vFanins.pArray[0]; }
 static inline int         Abc_ObjFaninId1( Abc_Obj_t * pObj )        { return pObj->vFanins.pArray[1]; }
 static inline int         Abc_ObjFanoutEdgeNum( Abc_Obj_t * pObj, Abc_Obj_t * pFanout )  { assert( Abc_NtkHasAig(pObj->pNtk) );  if ( Abc_ObjFaninId0(pFanout) == pObj->Id ) return 0; if ( Abc_ObjFaninId1(pFanout) == pObj->Id ) return 1; assert( 0 ); return -1;  }
@@ -531,6 +558,15 @@ static inline void        Abc_ObjSetMvVar( Abc_Obj_t * pObj, void * pV) { Vec_At
     for ( i = 0; (i < Abc_ObjFaninNum(pObj)) && (((iFanin) = Abc_ObjFaninId(pObj, i)), 1); i++ )
 #define Abc_ObjForEachFanoutId( pObj, iFanout, i )                                                 \
     for ( i = 0; (i < Abc_ObjFanoutNum(pObj)) && (((iFanout) = Abc_ObjFanoutId(pObj, i)), 1); i++ )
+// packed view of the network
+#define Abc_CsrForEachFanin( p, iObj, iFaninLit, k )                                               \
+    for ( k = (p)->pFinStart[iObj]; (k < (p)->pFinStart[(iObj)+1]) && (((iFaninLit) = (p)->pFanins[k]), 1); k++ )
+#define Abc_CsrForEachFanout( p, iObj, iFanout, k )                                                \
+    for ( k = (p)->pFoStart[iObj]; (k < (p)->pFoStart[(iObj)+1]) && (((iFanout) = (p)->pFanouts[k]), 1); k++ )
+#define Abc_CsrForEachNodeTopo( p, iObj, i )                                                       \
+    for ( i = 0; (i < (p)->nNodes) && (((iObj) = (p)->pOrder[i]), 1); i++ )
+#define Abc_CsrForEachNodeTopoReverse( p, iObj, i )                                                \
+    for ( i = (p)->nNodes - 1; (i >= 0) && (((iObj) = (p)->pOrder[i]), 1); i-- )
 // cubes and literals
 #define Abc_CubeForEachVar( pCube, Value, i )                                                      \
     for ( i = 0; (pCube[i] != ' ') && (Value = pCube[i]); i++ )           
@@ -603,6 +639,13 @@ extern ABC_DLL int                Abc_NtkCheckUniqueCioNames( Abc_Ntk_t * pNtk )
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapse( Abc_Ntk_t * pNtk, int fBddSizeMax, int fDualRail, int fReorder, int fReverse, int fDumpOrder, int fVerbose );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkCollapseSat( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int fVerbose );
 extern ABC_DLL Gia_Man_t *        Abc_NtkClpGia( Abc_Ntk_t * pNtk );
+/*=== abcCsr.c ==========================================================*/
+extern ABC_DLL Abc_Csr_t *        Abc_NtkCsrStart( Abc_Ntk_t * pNtk );
+extern ABC_DLL void               Abc_NtkCsrStop( Abc_Csr_t * p );
+extern ABC_DLL int                Abc_NtkCsrLevel( Abc_Csr_t * p );
+extern ABC_DLL int                Abc_NtkCsrLevelReverse( Abc_Csr_t * p );
+extern ABC_DLL void               Abc_NtkCsrTransferLevels( Abc_Csr_t * p, int fReverse );
+extern ABC_DLL int                Abc_NtkCsrStartReverseLevels( Abc_Ntk_t * pNtk );
 /*=== abcCut.c ==========================================================*/
 extern ABC_DLL void *             Abc_NodeGetCutsRecursive( void * p, Abc_Obj_t * pObj, int fDag, int fTree );
 extern ABC_DLL void *             Abc_NodeGetCuts( void * p, Abc_Obj_t * pObj, int fDag, int fTree );
@@ -647,7 +690,7 @@ extern ABC_DLL Vec_Ptr_t *        Abc_AigGetLevelizedOrder( Abc_Ntk_t * pNtk, in
 extern ABC_DLL int                Abc_ExactInputNum();
 extern ABC_DLL int                Abc_ExactIsRunning();
 extern ABC_DLL Abc_Obj_t *        Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile, Abc_Obj_t ** pFanins, Abc_Ntk_t * pNtk );
-extern ABC_DLL Abc_Ntk_t *        Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int fVerbose );
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int nProcs, int fVerbose );
 /*=== abcFanio.c ==========================================================*/
 extern ABC_DLL void               Abc_ObjAddFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin );
 extern ABC_DLL void               Abc_ObjDeleteFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin );
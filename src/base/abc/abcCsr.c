@@ -0,0 +1,262 @@
+/**CFile****************************************************************
+
+  FileName    [abcCsr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Packed structure-of-arrays view of the network.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: abcCsr.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "abc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static inline int Abc_CsrObjIsSource( Abc_Csr_t * p, int iObj ) { return p->pTypes[iObj] != ABC_OBJ_NODE && p->pTypes[iObj] != ABC_OBJ_CONST1; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the packed view of the network.]
+
+  Description [Fanins and fanouts of all objects are stored in two
+  compressed-sparse-row arrays indexed by object IDs, which are the same
+  as in the network. A fanin is stored as a literal, which is complemented
+  for the complemented edges of the strashed network. All arrays are
+  allocated in one memory block. The view is read-only; it becomes
+  invalid when the network is modified.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Csr_t * Abc_NtkCsrStart( Abc_Ntk_t * pNtk )
+{
+    Abc_Csr_t * p;
+    Abc_Obj_t * pObj;
+    int i, k, iFanin, nFanins = 0, nFanouts = 0, nNodes = 0, nInts;
+    int * pCounts, * pQueue, iHead, iTail;
+    assert( !Abc_NtkIsNetlist(pNtk) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        nFanins  += Abc_ObjFaninNum(pObj);
+        nFanouts += Abc_ObjFanoutNum(pObj);
+        nNodes   += (Abc_ObjIsNode(pObj) || Abc_ObjType(pObj) == ABC_OBJ_CONST1);
+    }
+    p = ABC_CALLOC( Abc_Csr_t, 1 );
+    p->pNtk     = pNtk;
+    p->nObjs    = Abc_NtkObjNumMax(pNtk);
+    p->nFanins  = nFanins;
+    p->nFanouts = nFanouts;
+    p->nNodes   = nNodes;
+    // allocate all arrays in one block
+    nInts = 2 * (p->nObjs + 1) + nFanins + nFanouts + 2 * p->nObjs + nNodes;
+    p->pArena    = ABC_ALLOC( char, sizeof(int) * nInts + p->nObjs );
+    p->pFinStart = (int *)p->pArena;
+    p->pFanins   = p->pFinStart + p->nObjs + 1;
+    p->pFoStart  = p->pFanins   + nFanins;
+    p->pFanouts  = p->pFoStart  + p->nObjs + 1;
+    p->pLevels   = p->pFanouts  + nFanouts;
+    p->pLevelsR  = p->pLevels   + p->nObjs;
+    p->pOrder    = p->pLevelsR  + p->nObjs;
+    p->pTypes    = (unsigned char *)(p->pOrder + nNodes);
+    memset( p->pLevels, 0, sizeof(int) * 2 * p->nObjs );
+    // fill in the fanins and fanouts
+    nFanins = nFanouts = 0;
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        p->pFinStart[i] = nFanins;
+        p->pFoStart[i]  = nFanouts;
+        pObj = Abc_NtkObj( pNtk, i );
+        p->pTypes[i] = pObj ? (unsigned char)Abc_ObjType(pObj) : (unsigned char)ABC_OBJ_NONE;
+        if ( pObj == NULL )
+            continue;
+        Abc_ObjForEachFaninId( pObj, iFanin, k )
+            p->pFanins[nFanins++] = Abc_Var2Lit( iFanin, Abc_NtkIsStrash(pNtk) && (k == 0 ? pObj->fCompl0 : k == 1 ? pObj->fCompl1 : 0) );
+        Abc_ObjForEachFanoutId( pObj, iFanin, k )
+            p->pFanouts[nFanouts++] = iFanin;
+    }
+    p->pFinStart[p->nObjs] = nFanins;
+    p->pFoStart[p->nObjs]  = nFanouts;
+    assert( nFanins == p->nFanins && nFanouts == p->nFanouts );
+    // order the internal nodes topologically, treating CIs and boxes as sources
+    pCounts = ABC_CALLOC( int, p->nObjs );
+    pQueue  = p->pOrder;
+    iHead = iTail = 0;
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        if ( Abc_CsrObjIsSource(p, i) )
+            continue;
+        Abc_CsrForEachFanin( p, i, iFanin, k )
+            pCounts[i] += !Abc_CsrObjIsSource(p, Abc_Lit2Var(iFanin));
+        if ( pCounts[i] == 0 )
+            pQueue[iTail++] = i;
+    }
+    while ( iHead < iTail )
+    {
+        int iObj = pQueue[iHead++];
+        Abc_CsrForEachFanout( p, iObj, iFanin, k )
+            if ( !Abc_CsrObjIsSource(p, iFanin) && --pCounts[iFanin] == 0 )
+                pQueue[iTail++] = iFanin;
+    }
+    ABC_FREE( pCounts );
+    if ( iTail < nNodes )
+        Abc_Print( -1, "Abc_NtkCsrStart(): The network has combinational loops.\n" );
+    p->nNodes = iTail;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the packed view.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCsrStop( Abc_Csr_t * p )
+{
+    ABC_FREE( p->pArena );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the levels of the objects.]
+
+  Description [Follows the conventions of Abc_NtkLevel() assuming that
+  the CIs have zero levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCsrLevel( Abc_Csr_t * p )
+{
+    int i, k, iObj, iFanin, Level, LevelMax = 0;
+    memset( p->pLevels, 0, sizeof(int) * p->nObjs );
+    Abc_CsrForEachNodeTopo( p, iObj, i )
+    {
+        Level = 0;
+        Abc_CsrForEachFanin( p, iObj, iFanin, k )
+            Level = Abc_MaxInt( Level, p->pLevels[Abc_Lit2Var(iFanin)] );
+        if ( Abc_CsrObjFaninNum(p, iObj) > 0 )
+            Level++;
+        p->pLevels[iObj] = Level;
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    return LevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reverse levels of the objects.]
+
+  Description [Follows the conventions of Abc_NtkLevelReverse().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCsrLevelReverse( Abc_Csr_t * p )
+{
+    int i, k, iObj, iFanout, Level, LevelMax = 0;
+    memset( p->pLevelsR, 0, sizeof(int) * p->nObjs );
+    Abc_CsrForEachNodeTopoReverse( p, iObj, i )
+    {
+        Level = 0;
+        Abc_CsrForEachFanout( p, iObj, iFanout, k )
+            Level = Abc_MaxInt( Level, p->pLevelsR[iFanout] );
+        p->pLevelsR[iObj] = ++Level;
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    return LevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the levels computed in the packed view to the network.]
+
+  Description [The levels are written into the CIs and the internal nodes.
+  The reverse levels, if requested, are written into the array of reverse
+  levels of the network, which should be allocated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCsrTransferLevels( Abc_Csr_t * p, int fReverse )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    assert( p->nObjs == Abc_NtkObjNumMax(p->pNtk) );
+    assert( !fReverse || Vec_IntSize(p->pNtk->vLevelsR) > p->nObjs );
+    Abc_NtkForEachObj( p->pNtk, pObj, i )
+    {
+        if ( !Abc_ObjIsNode(pObj) && !Abc_ObjIsCi(pObj) )
+            continue;
+        pObj->Level = p->pLevels[i];
+        if ( fReverse && Abc_ObjIsNode(pObj) )
+            Vec_IntWriteEntry( p->pNtk->vLevelsR, i, p->pLevelsR[i] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the levels and the reverse levels of the AIG.]
+
+  Description [Performs the same computation as Abc_NtkLevel() followed
+  by the reverse-level computation of Abc_NtkStartReverseLevels() but
+  traverses the packed view instead of the objects. Returns the number
+  of levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCsrStartReverseLevels( Abc_Ntk_t * pNtk )
+{
+    Abc_Csr_t * p;
+    int LevelMax;
+    assert( Abc_NtkIsStrash(pNtk) && pNtk->vLevelsR != NULL );
+    p = Abc_NtkCsrStart( pNtk );
+    LevelMax = Abc_NtkCsrLevel( p );
+    Abc_NtkCsrLevelReverse( p );
+    Abc_NtkCsrTransferLevels( p, 1 );
+    Abc_NtkCsrStop( p );
+    return LevelMax;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -31,6 +31,17 @@
 #include "proof/cec/cec.h"
 #include "sat/bsat/satSolver.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -204,6 +215,8 @@ static inline void Abc_DebugErase( int n, int fCond )
 #define ABC_EXACT_SOL_NFUNC  1
 #define ABC_EXACT_SOL_NGATES 2
 
+#define SES_THR_MAX 100
+
 #define ANSI_COLOR_RED     "\x1b[31m"
 #define ANSI_COLOR_GREEN   "\x1b[32m"
 #define ANSI_COLOR_YELLOW  "\x1b[33m"
@@ -241,6 +254,9 @@ struct Ses_Man_t_
     Vec_Int_t *  vAssump;               /* assumptions */
     int          nRandRowAssigns;       /* number of random row assignments to initialize CEGAR */
     int          fKeepRowAssigns;       /* if 1, keep counter examples in CEGAR for next number of gates */
+    int          nProcs;                /* number of threads trying different numbers of gates */
+    Vec_Int_t *  vRandVals;             /* values of rand() drawn for the row assignments of the concurrent search */
+    int          iRandVal;              /* the number of these values used so far */
 
     int          nGates;                /* number of gates */
     int          nStartGates;           /* number of gates to start search (-1), i.e., to start from 1 gate, one needs to specify 0 */
@@ -316,6 +332,7 @@ struct Ses_Store_t_
     int                fVerbose;                       /* be verbose */
     int                fVeryVerbose;                   /* be very verbose */
     int                nBTLimit;                       /* conflict limit */
+    int                nProcs;                         /* number of threads used by exact synthesis */
     int                nEntriesCount;                  /* number of entries */
     int                nValidEntriesCount;             /* number of entries with network */
     Ses_TruthEntry_t * pEntries[SES_STORE_TABLE_SIZE]; /* hash table for truth table entries */
@@ -925,6 +942,9 @@ static inline Ses_Man_t * Ses_ManAlloc( word * pTruth, int nVars, int nFunc, int
     p->vStairDecVars   = Vec_IntAlloc( nVars );
     p->nRandRowAssigns = 2 * nVars;
     p->fKeepRowAssigns = 0;
+    p->nProcs          = 1;
+    p->vRandVals       = Vec_IntAlloc( 100 );
+    p->iRandVal        = 0;
 
     if ( p->nSpecFunc == 1 )
         Ses_ManComputeTopDec( p );
@@ -949,6 +969,7 @@ static inline void Ses_ManCleanLight( Ses_Man_t * pSes )
     Vec_IntFree( pSes->vPolar );
     Vec_IntFree( pSes->vAssump );
     Vec_IntFree( pSes->vStairDecVars );
+    Vec_IntFree( pSes->vRandVals );
 
     ABC_FREE( pSes );
 }
@@ -960,6 +981,47 @@ static inline void Ses_ManClean( Ses_Man_t * pSes )
     Ses_ManCleanLight( pSes );
 }
 
+/* copy of the manager with its own SAT solver, used to try another number of gates on a different thread */
+static inline Ses_Man_t * Ses_ManDup( Ses_Man_t * pSes )
+{
+    Ses_Man_t * p = ABC_ALLOC( Ses_Man_t, 1 );
+    memcpy( p, pSes, sizeof( Ses_Man_t ) );
+    p->pSat            = NULL;
+    p->fVeryVerbose    = 0;
+    p->fExtractVerbose = 0;
+    p->fSatVerbose     = 0;
+    p->fReasonVerbose  = 0;
+    p->vPolar          = Vec_IntAlloc( 100 );
+    p->vAssump         = Vec_IntAlloc( 10 );
+    p->vStairDecVars   = Vec_IntDup( pSes->vStairDecVars );
+    p->vRandVals       = NULL;
+    p->timeSat = p->timeSatSat = p->timeSatUnsat = p->timeSatUndef = p->timeInstance = 0;
+    p->nSatCalls = p->nUnsatCalls = p->nUndefCalls = 0;
+    return p;
+}
+
+/* the spec and the arrival times are shared with the original manager, so they are not restored here */
+static inline void Ses_ManDupFree( Ses_Man_t * p )
+{
+    if ( p->pSat )
+        sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vPolar );
+    Vec_IntFree( p->vAssump );
+    Vec_IntFree( p->vStairDecVars );
+    ABC_FREE( p );
+}
+
+/* the concurrent search draws the rows of several numbers of gates ahead; the values of rand() are
+   recorded, so that the rows of the numbers of gates not committed are reused, as in the sequential search */
+static inline int Ses_ManRandom( Ses_Man_t * pSes )
+{
+    if ( pSes->nProcs <= 1 )
+        return rand();
+    if ( pSes->iRandVal == Vec_IntSize( pSes->vRandVals ) )
+        Vec_IntPush( pSes->vRandVals, rand() );
+    return Vec_IntEntry( pSes->vRandVals, pSes->iRandVal++ );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Access variables based on indexes.]
@@ -2234,12 +2296,13 @@ static int Ses_ManFindNetworkExact( Ses_Man_t * pSes, int nGates )
     return 2; /* UNSAT continue */
 }
 
+static int Ses_ManFindNetworkExactCEGARInt( Ses_Man_t * pSes, int nGates, char ** pSol );
+
 // is there a network for a given number of gates
 /* return: (3: impossible, 2: continue, 1: found, 0: gave up) */
 static int Ses_ManFindNetworkExactCEGAR( Ses_Man_t * pSes, int nGates, char ** pSol )
 {
-    int fRes, iMint, fSat, i;
-    word pTruth[4];
+    int i;
 
     /* debug */
     Abc_DebugErase( pSes->nDebugOffset + ( nGates > 10 ? 5 : 4 ), pSes->fVeryVerbose );
@@ -2250,7 +2313,16 @@ static int Ses_ManFindNetworkExactCEGAR( Ses_Man_t * pSes, int nGates, char ** p
         return 3;
 
     for ( i = 0; i < pSes->nRandRowAssigns; ++i )
-        Abc_TtSetBit( pSes->pTtValues, rand() % pSes->nRows );
+        Abc_TtSetBit( pSes->pTtValues, Ses_ManRandom( pSes ) % pSes->nRows );
+
+    return Ses_ManFindNetworkExactCEGARInt( pSes, nGates, pSol );
+}
+
+/* CEGAR loop starting from the rows currently assigned in pTtValues */
+static int Ses_ManFindNetworkExactCEGARInt( Ses_Man_t * pSes, int nGates, char ** pSol )
+{
+    int fRes, iMint, fSat;
+    word pTruth[4];
 
     fRes = Ses_ManFindNetworkExact( pSes, nGates );
     if ( fRes != 1 ) return fRes;
@@ -2279,6 +2351,116 @@ static int Ses_ManFindNetworkExactCEGAR( Ses_Man_t * pSes, int nGates, char ** p
     }
 }
 
+// try the next nProcs numbers of gates on concurrent threads
+/* return: as for Ses_ManFindNetworkExactCEGAR for the smallest number of gates whose result is not 2 */
+#ifdef ABC_USE_PTHREADS
+typedef struct Ses_ThData_t_ Ses_ThData_t;
+struct Ses_ThData_t_
+{
+    Ses_Man_t *  pSes;                  /* manager owned by this thread */
+    int          nGates;                /* number of gates to try */
+    int          fRes;                  /* result of CEGAR */
+    char *       pSol;                  /* solution, if found */
+};
+
+void * Ses_ManWorkerThread( void * pArg )
+{
+    Ses_ThData_t * pThData = (Ses_ThData_t *)pArg;
+    pThData->fRes = Ses_ManFindNetworkExactCEGARInt( pThData->pSes, pThData->nGates, &pThData->pSol );
+    return NULL;
+}
+
+static int Ses_ManFindNetworkExactParallel( Ses_Man_t * pSes, int * pnGates, char ** pSol )
+{
+    Ses_ThData_t ThData[SES_THR_MAX];
+    pthread_t WorkerThread[SES_THR_MAX];
+    int pRandVals[SES_THR_MAX];
+    int i, j, nJobs, iBest, status, fRes = 2;
+
+    /* select the numbers of gates allowed by the constraints and assign the random rows
+       in the same order as the sequential search, each job keeping the rows of the previous ones */
+    for ( nJobs = 0; nJobs < pSes->nProcs; nJobs++ )
+    {
+        int nGates = *pnGates + nJobs + 1;
+        Abc_DebugErase( pSes->nDebugOffset + ( nGates > 10 ? 5 : 4 ), pSes->fVeryVerbose );
+        Abc_DebugPrintIntInt( " (%d/%d)", nGates, pSes->nMaxGates, pSes->fVeryVerbose );
+        if ( !Ses_CheckGatesConsistency( pSes, nGates ) )
+            break;
+        ThData[nJobs].pSes   = nJobs ? Ses_ManDup( pSes ) : pSes;
+        ThData[nJobs].nGates = nGates;
+        ThData[nJobs].fRes   = 2;
+        ThData[nJobs].pSol   = NULL;
+        if ( nJobs )
+            memcpy( ThData[nJobs].pSes->pTtValues, ThData[nJobs-1].pSes->pTtValues, 4 * sizeof( word ) );
+        for ( j = 0; j < pSes->nRandRowAssigns; ++j )
+            Abc_TtSetBit( ThData[nJobs].pSes->pTtValues, Ses_ManRandom( pSes ) % pSes->nRows );
+        pRandVals[nJobs] = pSes->iRandVal;
+    }
+    if ( nJobs == 0 )
+    {
+        ++*pnGates;
+        return 3;
+    }
+
+    /* the calling thread takes the smallest number of gates and reuses its SAT solver */
+    for ( i = 1; i < nJobs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Ses_ManWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Ses_ManWorkerThread( (void *)ThData );
+    for ( i = 1; i < nJobs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+
+    /* commit the results in the order of the sequential search */
+    for ( iBest = 0; iBest < nJobs; iBest++ )
+        if ( ThData[iBest].fRes != 2 )
+            break;
+    if ( iBest < nJobs )
+    {
+        fRes  = ThData[iBest].fRes;
+        *pSol = ThData[iBest].pSol;
+        ThData[iBest].pSol = NULL;
+        *pnGates += iBest + 1;
+    }
+    else
+    {
+        /* none worked out; the next call reports whether more gates are possible */
+        iBest = nJobs - 1;
+        *pnGates += nJobs;
+    }
+    /* continue as if the numbers of gates after the committed one were never tried */
+    pSes->nGates = ThData[iBest].pSes->nGates;
+    pSes->iRandVal = pRandVals[iBest];
+    if ( iBest )
+        memcpy( pSes->pTtValues, ThData[iBest].pSes->pTtValues, 4 * sizeof( word ) );
+    for ( i = 0; i < nJobs; i++ )
+    {
+        ABC_FREE( ThData[i].pSol );
+        if ( i == 0 )
+            continue;
+        pSes->nSatCalls    += ThData[i].pSes->nSatCalls;
+        pSes->nUnsatCalls  += ThData[i].pSes->nUnsatCalls;
+        pSes->nUndefCalls  += ThData[i].pSes->nUndefCalls;
+        pSes->timeSat      += ThData[i].pSes->timeSat;
+        pSes->timeSatSat   += ThData[i].pSes->timeSatSat;
+        pSes->timeSatUnsat += ThData[i].pSes->timeSatUnsat;
+        pSes->timeSatUndef += ThData[i].pSes->timeSatUndef;
+        pSes->timeInstance += ThData[i].pSes->timeInstance;
+        Ses_ManDupFree( ThData[i].pSes );
+    }
+    return fRes;
+}
+#else
+static int Ses_ManFindNetworkExactParallel( Ses_Man_t * pSes, int * pnGates, char ** pSol )
+{
+    return Ses_ManFindNetworkExactCEGAR( pSes, ++*pnGates, pSol );
+}
+#endif
+
 // find minimum size by increasing the number of gates
 static char * Ses_ManFindMinimumSizeBottomUp( Ses_Man_t * pSes )
 {
@@ -2302,9 +2484,14 @@ static char * Ses_ManFindMinimumSizeBottomUp( Ses_Man_t * pSes )
 
     while ( true )
     {
-        ++nGates;
-
-        fRes = Ses_ManFindNetworkExactCEGAR( pSes, nGates, &pSol );
+        /* the concurrent jobs cannot see the counter-examples kept by the smaller numbers of gates */
+        if ( pSes->nProcs > 1 && !pSes->fKeepRowAssigns )
+            fRes = Ses_ManFindNetworkExactParallel( pSes, &nGates, &pSol );
+        else
+        {
+            ++nGates;
+            fRes = Ses_ManFindNetworkExactCEGAR( pSes, nGates, &pSol );
+        }
 
         if ( fRes == 0 )
         {
@@ -2411,7 +2598,7 @@ static char * Ses_ManFindMinimumSize( Ses_Man_t * pSes )
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nProcs, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2425,6 +2612,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 0, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nProcs = Abc_MaxInt( 1, Abc_MinInt( nProcs, SES_THR_MAX ) );
     pSes->fReasonVerbose = 0;
     pSes->fSatVerbose = 0;
     if ( fVerbose )
@@ -2447,7 +2635,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
     return pNtk;
 }
 
-Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nProcs, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2461,6 +2649,7 @@ Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 1, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nProcs = Abc_MaxInt( 1, Abc_MinInt( nProcs, SES_THR_MAX ) );
     pSes->fVeryVerbose = 1;
     pSes->fExtractVerbose = 0;
     pSes->fSatVerbose = 0;
@@ -2516,30 +2705,30 @@ void Abc_ExactTestSingleOutput( int fVerbose )
 
     pNtk = Abc_NtkFromTruthTable( pTruth, 4 );
 
-    pNtk2 = Abc_NtkFindExact( pTruth, 4, 1, -1, NULL, 0, 0, fVerbose );
+    pNtk2 = Abc_NtkFindExact( pTruth, 4, 1, -1, NULL, 0, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk2 );
     Abc_NtkCecSat( pNtk, pNtk2, 10000, 0 );
     assert( pNtk2 );
     assert( Abc_NtkNodeNum( pNtk2 ) == 6 );
     Abc_NtkDelete( pNtk2 );
 
-    pNtk3 = Abc_NtkFindExact( pTruth, 4, 1, 3, NULL, 0, 0, fVerbose );
+    pNtk3 = Abc_NtkFindExact( pTruth, 4, 1, 3, NULL, 0, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk3 );
     Abc_NtkCecSat( pNtk, pNtk3, 10000, 0 );
     assert( pNtk3 );
     assert( Abc_NtkLevel( pNtk3 ) <= 3 );
     Abc_NtkDelete( pNtk3 );
 
-    pNtk4 = Abc_NtkFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, fVerbose );
+    pNtk4 = Abc_NtkFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, 1, fVerbose );
     Abc_NtkShortNames( pNtk4 );
     Abc_NtkCecSat( pNtk, pNtk4, 10000, 0 );
     assert( pNtk4 );
     assert( Abc_NtkLevel( pNtk4 ) <= 9 );
     Abc_NtkDelete( pNtk4 );
 
-    assert( !Abc_NtkFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, fVerbose ) );
+    assert( !Abc_NtkFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, 1, fVerbose ) );
 
-    assert( !Abc_NtkFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, fVerbose ) );
+    assert( !Abc_NtkFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, 1, fVerbose ) );
 
     Abc_NtkDelete( pNtk );
 }
@@ -2558,27 +2747,27 @@ void Abc_ExactTestSingleOutputAIG( int fVerbose )
     Abc_NtkToAig( pNtk );
     pGia = Abc_NtkAigToGia( pNtk, 1 );
 
-    pGia2 = Gia_ManFindExact( pTruth, 4, 1, -1, NULL, 0, 0, fVerbose );
+    pGia2 = Gia_ManFindExact( pTruth, 4, 1, -1, NULL, 0, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia2, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    pGia3 = Gia_ManFindExact( pTruth, 4, 1, 3, NULL, 0, 0, fVerbose );
+    pGia3 = Gia_ManFindExact( pTruth, 4, 1, 3, NULL, 0, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia3, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    pGia4 = Gia_ManFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, fVerbose );
+    pGia4 = Gia_ManFindExact( pTruth, 4, 1, 9, pArrTimeProfile, 50000, 0, 1, fVerbose );
     pMiter = Gia_ManMiter( pGia, pGia4, 0, 1, 0, 0, 1 );
     assert( pMiter );
     Cec_ManVerify( pMiter, pPars );
     Gia_ManStop( pMiter );
 
-    assert( !Gia_ManFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, fVerbose ) );
+    assert( !Gia_ManFindExact( pTruth, 4, 1, 2, NULL, 50000, 0, 1, fVerbose ) );
 
-    assert( !Gia_ManFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, fVerbose ) );
+    assert( !Gia_ManFindExact( pTruth, 4, 1, 8, pArrTimeProfile, 50000, 0, 1, fVerbose ) );
 
     Gia_ManStop( pGia );
     Gia_ManStop( pGia2 );
@@ -2613,11 +2802,12 @@ int Abc_ExactInputNum()
     return 8;
 }
 // start exact store manager
-void Abc_ExactStart( int nBTLimit, int fMakeAIG, int fVerbose, int fVeryVerbose, const char * pFilename )
+void Abc_ExactStart( int nBTLimit, int fMakeAIG, int nProcs, int fVerbose, int fVeryVerbose, const char * pFilename )
 {
     if ( !s_pSesStore )
     {
         s_pSesStore = Ses_StoreAlloc( nBTLimit, fMakeAIG, fVerbose );
+        s_pSesStore->nProcs = Abc_MaxInt( 1, Abc_MinInt( nProcs, SES_THR_MAX ) );
         s_pSesStore->fVeryVerbose = fVeryVerbose;
         if ( pFilename )
         {
@@ -2793,6 +2983,7 @@ int Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char *
         pSes->fVeryVerbose = s_pSesStore->fVeryVerbose;
         pSes->pSat = s_pSesStore->pSat;
         pSes->nStartGates = nVars - 2;
+        pSes->nProcs = s_pSesStore->nProcs;
 
         while ( pSes->nMaxDepth ) /* there is improvement */
         {
@@ -2999,7 +3190,7 @@ void Abc_ExactStoreTest( int fVerbose )
     }
     Abc_NodeFreeNames( vNames );
 
-    Abc_ExactStart( 10000, 1, fVerbose, 0, NULL );
+    Abc_ExactStart( 10000, 1, 1, fVerbose, 0, NULL );
 
     assert( !Abc_ExactBuildNode( pTruth, 4, pArrTimeProfile, pFanins, pNtk ) );
 
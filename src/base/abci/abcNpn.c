@@ -174,7 +174,7 @@ void Abc_TruthNpnPrint( char * pCanonPermInit, unsigned uCanonPhase, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
+void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int nProcs, int fVerbose )
 {
     unsigned pAux[2048];
     word pAuxWord[1024], pAuxWord1[1024];
@@ -279,6 +279,16 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
     }
+    else if ( NpnType == 5 && nProcs > 1 && !fVerbose )
+    {
+        Abc_TtBatch_t * pBatch = Abc_TtBatchStart( p->nVars, nProcs );
+        Vec_Int_t * vClasses = Abc_TtBatchCanonicize( pBatch, p->pFuncs[0], p->nFuncs );
+        int iClass;
+        Vec_IntForEachEntry( vClasses, iClass, i )
+            memcpy( p->pFuncs[i], Abc_TtBatchClass(pBatch, iClass), sizeof(word) * p->nWords );
+        Vec_IntFree( vClasses );
+        Abc_TtBatchStop( pBatch );
+    }
     else if ( NpnType == 5 )
     {
         for ( i = 0; i < p->nFuncs; i++ )
@@ -386,7 +396,7 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int nProcs, int fDumpRes, int fBinary, int fVerbose )
 {
     Abc_TtStore_t * p;
     char * pFileNameOut;
@@ -397,7 +407,7 @@ void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes,
         return;
 
     // consider functions from the file
-    Abc_TruthNpnPerform( p, NpnType, fVerbose );
+    Abc_TruthNpnPerform( p, NpnType, nProcs, fVerbose );
 
     // write the result
     if ( fDumpRes )
@@ -428,12 +438,12 @@ void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes,
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int nProcs, int fDumpRes, int fBinary, int fVerbose )
 {
     if ( fVerbose )
         printf( "Using truth tables from file \"%s\"...\n", pFileName );
     if ( NpnType >= 0 && NpnType <= 12 )
-        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
+        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, nProcs, fDumpRes, fBinary, fVerbose );
     else
         printf( "Unknown canonical form value (%d).\n", NpnType );
     fflush( stdout );
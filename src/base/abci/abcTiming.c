@@ -1276,11 +1276,17 @@ void Abc_NtkStartReverseLevels( Abc_Ntk_t * pNtk, int nMaxLevelIncrease )
     Vec_Ptr_t * vNodes;
     Abc_Obj_t * pObj;
     int i;
-    // remember the maximum number of direct levels
-    pNtk->LevelMax = Abc_NtkLevel(pNtk) + nMaxLevelIncrease;
     // start the reverse levels
     pNtk->vLevelsR = Vec_IntAlloc( 0 );
     Vec_IntFill( pNtk->vLevelsR, 1 + Abc_NtkObjNumMax(pNtk), 0 );
+    // traverse the packed view of the AIG when the CIs have zero levels
+    if ( Abc_NtkIsStrash(pNtk) && pNtk->nBarBufs == 0 && (pNtk->pManTime == NULL || pNtk->AndGateDelay <= 0) )
+    {
+        pNtk->LevelMax = Abc_NtkCsrStartReverseLevels(pNtk) + nMaxLevelIncrease;
+        return;
+    }
+    // remember the maximum number of direct levels
+    pNtk->LevelMax = Abc_NtkLevel(pNtk) + nMaxLevelIncrease;
     // compute levels in reverse topological order
     vNodes = Abc_NtkDfsReverse( pNtk );
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
@@ -89,7 +89,7 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddAddAbs.c,v 1.15 2004/08/13 18:04:45 fabio Exp $";
 #endif
 
-static  DdNode  *two;
+static DD_TLS  DdNode  *two;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -97,7 +97,7 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddApa.c,v 1.19 2009/03/08 01:27:50 fabio Exp $";
 #endif
 
-static  DdNode  *background, *zero;
+static DD_TLS  DdNode  *background, *zero;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -111,12 +111,12 @@ static char rcsid[] DD_UNUSED = "$Id: cuddCompose.c,v 1.45 2004/08/13 18:04:47 f
 #endif
 
 #ifdef DD_DEBUG
-static int addPermuteRecurHits;
-static int bddPermuteRecurHits;
-static int bddVectorComposeHits;
-static int addVectorComposeHits;
+static DD_TLS int addPermuteRecurHits;
+static DD_TLS int bddPermuteRecurHits;
+static DD_TLS int bddVectorComposeHits;
+static DD_TLS int addVectorComposeHits;
 
-static int addGeneralVectorComposeHits;
+static DD_TLS int addGeneralVectorComposeHits;
 #endif
 
 /*---------------------------------------------------------------------------*/
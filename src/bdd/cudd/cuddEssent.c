@@ -150,10 +150,10 @@ typedef struct TlClause TlClause;
 static char rcsid[] DD_UNUSED = "$Id: cuddEssent.c,v 1.24 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static BitVector *Tolv;
-static BitVector *Tolp;
-static BitVector *Eolv;
-static BitVector *Eolp;
+static DD_TLS BitVector *Tolv;
+static DD_TLS BitVector *Tolp;
+static DD_TLS BitVector *Eolv;
+static DD_TLS BitVector *Eolp;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
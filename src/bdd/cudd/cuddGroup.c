@@ -113,21 +113,21 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddGroup.c,v 1.44 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static  int     *entry;
-extern  int     ddTotalNumberSwapping;
+static DD_TLS  int     *entry;
+extern DD_TLS  int     ddTotalNumberSwapping;
 #ifdef DD_STATS
-extern  int     ddTotalNISwaps;
-static  int     extsymmcalls;
-static  int     extsymm;
-static  int     secdiffcalls;
-static  int     secdiff;
-static  int     secdiffmisfire;
+extern DD_TLS  int     ddTotalNISwaps;
+static DD_TLS  int     extsymmcalls;
+static DD_TLS  int     extsymm;
+static DD_TLS  int     secdiffcalls;
+static DD_TLS  int     secdiff;
+static DD_TLS  int     secdiffmisfire;
 #endif
 #ifdef DD_DEBUG
 static  int     pr = 0; /* flag to enable printing while debugging */
                         /* by depositing a 1 into it */
 #endif
-static unsigned int originalSize;
+static DD_TLS unsigned int originalSize;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
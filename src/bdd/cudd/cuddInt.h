@@ -92,6 +92,21 @@ ABC_NAMESPACE_HEADER_START
 # define DD_UNUSED
 #endif
 
+/* Storage class of the variables kept by the package outside of the
+** manager (reordering scratch arrays, cached constants, the state of the
+** random number generator, statistics). Making them local to the thread
+** allows separate managers to be used concurrently by different threads.
+*/
+#if defined(ABC_USE_PTHREADS)
+# if defined(_MSC_VER)
+#   define DD_TLS __declspec(thread)
+# else
+#   define DD_TLS __thread
+# endif
+#else
+# define DD_TLS
+#endif
+
 
 /*---------------------------------------------------------------------------*/
 /* Constant declarations                                                     */
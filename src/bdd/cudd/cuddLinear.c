@@ -99,12 +99,12 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddLinear.c,v 1.28 2009/02/19 16:21:03 fabio Exp $";
 #endif
 
-static  int     *entry;
+static DD_TLS  int     *entry;
 
 #ifdef DD_STATS
-extern  int     ddTotalNumberSwapping;
-extern  int     ddTotalNISwaps;
-static  int     ddTotalNumberLinearTr;
+extern DD_TLS  int     ddTotalNumberSwapping;
+extern DD_TLS  int     ddTotalNISwaps;
+static DD_TLS  int     ddTotalNumberLinearTr;
 #endif
 
 #ifdef DD_DEBUG
@@ -102,11 +102,11 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddReorder.c,v 1.69 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static  int     *entry;
+static DD_TLS  int     *entry;
 
-int     ddTotalNumberSwapping;
+DD_TLS int     ddTotalNumberSwapping;
 #ifdef DD_STATS
-int     ddTotalNISwaps;
+DD_TLS int     ddTotalNISwaps;
 #endif
 
 /*---------------------------------------------------------------------------*/
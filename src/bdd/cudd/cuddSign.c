@@ -83,11 +83,11 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddSign.c,v 1.22 2009/02/20 02:14:58 fabio Exp $";
 #endif
 
-static int    size;
+static DD_TLS int    size;
 
 #ifdef DD_STATS
-static int num_calls;   /* should equal 2n-1 (n is the # of nodes) */
-static int table_mem;
+static DD_TLS int num_calls; /* should equal 2n-1 (n is the # of nodes) */
+static DD_TLS int table_mem;
 #endif
 
 
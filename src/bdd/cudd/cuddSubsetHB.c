@@ -120,37 +120,37 @@ typedef struct NodeData NodeData_t;
 static char rcsid[] DD_UNUSED = "$Id: cuddSubsetHB.c,v 1.37 2009/02/20 02:14:58 fabio Exp $";
 #endif
 
-static int memOut;
+static DD_TLS int memOut;
 #ifdef DEBUG
-static  int             num_calls;
+static DD_TLS  int             num_calls;
 #endif
 
-static  DdNode          *zero, *one; /* constant functions */
-static  double          **mintermPages; /* pointers to the pages */
-static  int             **nodePages; /* pointers to the pages */
-static  int             **lightNodePages; /* pointers to the pages */
-static  double          *currentMintermPage; /* pointer to the current
+static DD_TLS  DdNode          *zero, *one; /* constant functions */
+static DD_TLS  double          **mintermPages; /* pointers to the pages */
+static DD_TLS  int             **nodePages; /* pointers to the pages */
+static DD_TLS  int             **lightNodePages; /* pointers to the pages */
+static DD_TLS  double          *currentMintermPage; /* pointer to the current
                                                    page */
-static  double          max; /* to store the 2^n value of the number
+static DD_TLS  double          max; /* to store the 2^n value of the number
                               * of variables */
 
-static  int             *currentNodePage; /* pointer to the current
+static DD_TLS  int             *currentNodePage; /* pointer to the current
                                                    page */
-static  int             *currentLightNodePage; /* pointer to the
+static DD_TLS  int             *currentLightNodePage; /* pointer to the
                                                 *  current page */
-static  int             pageIndex; /* index to next element */
-static  int             page; /* index to current page */
-static  int             pageSize = DEFAULT_PAGE_SIZE; /* page size */
-static  int             maxPages; /* number of page pointers */
+static DD_TLS  int             pageIndex; /* index to next element */
+static DD_TLS  int             page; /* index to current page */
+static DD_TLS  int             pageSize = DEFAULT_PAGE_SIZE; /* page size */
+static DD_TLS  int             maxPages; /* number of page pointers */
 
-static  NodeData_t      *currentNodeDataPage; /* pointer to the current
+static DD_TLS  NodeData_t      *currentNodeDataPage; /* pointer to the current
                                                  page */
-static  int             nodeDataPage; /* index to next element */
-static  int             nodeDataPageIndex; /* index to next element */
-static  NodeData_t      **nodeDataPages; /* index to current page */
-static  int             nodeDataPageSize = DEFAULT_NODE_DATA_PAGE_SIZE;
+static DD_TLS  int             nodeDataPage; /* index to next element */
+static DD_TLS  int             nodeDataPageIndex; /* index to next element */
+static DD_TLS  NodeData_t      **nodeDataPages; /* index to current page */
+static DD_TLS  int             nodeDataPageSize = DEFAULT_NODE_DATA_PAGE_SIZE;
                                                      /* page size */
-static  int             maxNodeDataPages; /* number of page pointers */
+static DD_TLS  int             maxNodeDataPages; /* number of page pointers */
 
 
 /*---------------------------------------------------------------------------*/
@@ -130,28 +130,28 @@ static char rcsid[] DD_UNUSED = "$Id: cuddSubsetSP.c,v 1.34 2009/02/19 16:23:19
 #endif
 
 #ifdef DD_DEBUG
-static int numCalls;
-static int hits;
-static int thishit;
+static DD_TLS int numCalls;
+static DD_TLS int hits;
+static DD_TLS int thishit;
 #endif
 
 
-static  int             memOut; /* flag to indicate out of memory */
-static  DdNode          *zero, *one; /* constant functions */
+static DD_TLS  int             memOut; /* flag to indicate out of memory */
+static DD_TLS  DdNode          *zero, *one; /* constant functions */
 
-static  NodeDist_t      **nodeDistPages; /* pointers to the pages */
-static  int             nodeDistPageIndex; /* index to next element */
-static  int             nodeDistPage; /* index to current page */
-static  int             nodeDistPageSize = DEFAULT_NODE_DIST_PAGE_SIZE; /* page size */
-static  int             maxNodeDistPages; /* number of page pointers */
-static  NodeDist_t      *currentNodeDistPage; /* current page */
+static DD_TLS  NodeDist_t      **nodeDistPages; /* pointers to the pages */
+static DD_TLS  int             nodeDistPageIndex; /* index to next element */
+static DD_TLS  int             nodeDistPage; /* index to current page */
+static DD_TLS  int             nodeDistPageSize = DEFAULT_NODE_DIST_PAGE_SIZE; /* page size */
+static DD_TLS  int             maxNodeDistPages; /* number of page pointers */
+static DD_TLS  NodeDist_t      *currentNodeDistPage; /* current page */
 
-static  DdNode          ***queuePages; /* pointers to the pages */
-static  int             queuePageIndex; /* index to next element */
-static  int             queuePage; /* index to current page */
-static  int             queuePageSize = DEFAULT_PAGE_SIZE; /* page size */
-static  int             maxQueuePages; /* number of page pointers */
-static  DdNode          **currentQueuePage; /* current page */
+static DD_TLS  DdNode          ***queuePages; /* pointers to the pages */
+static DD_TLS  int             queuePageIndex; /* index to next element */
+static DD_TLS  int             queuePage; /* index to current page */
+static DD_TLS  int             queuePageSize = DEFAULT_PAGE_SIZE; /* page size */
+static DD_TLS  int             maxQueuePages; /* number of page pointers */
+static DD_TLS  DdNode          **currentQueuePage; /* current page */
 
 
 /*---------------------------------------------------------------------------*/
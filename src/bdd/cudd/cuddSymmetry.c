@@ -94,11 +94,11 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddSymmetry.c,v 1.26 2009/02/19 16:23:54 fabio Exp $";
 #endif
 
-static  int     *entry;
+static DD_TLS  int     *entry;
 
-extern  int     ddTotalNumberSwapping;
+extern DD_TLS  int     ddTotalNumberSwapping;
 #ifdef DD_STATS
-extern  int     ddTotalNISwaps;
+extern DD_TLS  int     ddTotalNISwaps;
 #endif
 
 /*---------------------------------------------------------------------------*/
@@ -145,12 +145,12 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddUtil.c,v 1.81 2009/03/08 02:49:02 fabio Exp $";
 #endif
 
-static  DdNode  *background, *zero;
+static DD_TLS  DdNode  *background, *zero;
 
-static  long cuddRand = 0;
-static  long cuddRand2;
-static  long shuffleSelect;
-static  long shuffleTable[STAB_SIZE];
+static DD_TLS  long cuddRand = 0;
+static DD_TLS  long cuddRand2;
+static DD_TLS  long shuffleSelect;
+static DD_TLS  long shuffleTable[STAB_SIZE];
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
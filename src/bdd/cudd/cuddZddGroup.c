@@ -94,14 +94,14 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddZddGroup.c,v 1.20 2009/02/19 16:25:36 fabio Exp $";
 #endif
 
-static  int     *entry;
-extern  int     zddTotalNumberSwapping;
+static DD_TLS  int     *entry;
+extern DD_TLS  int     zddTotalNumberSwapping;
 #ifdef DD_STATS
-static  int     extsymmcalls;
-static  int     extsymm;
-static  int     secdiffcalls;
-static  int     secdiff;
-static  int     secdiffmisfire;
+static DD_TLS  int     extsymmcalls;
+static DD_TLS  int     extsymm;
+static DD_TLS  int     secdiffcalls;
+static DD_TLS  int     secdiff;
+static DD_TLS  int     secdiffmisfire;
 #endif
 #ifdef DD_DEBUG
 static  int     pr = 0; /* flag to enable printing while debugging */
@@ -92,10 +92,10 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddZddLin.c,v 1.14 2004/08/13 18:04:53 fabio Exp $";
 #endif
 
-extern  int     *zdd_entry;
-extern  int     zddTotalNumberSwapping;
-static  int     zddTotalNumberLinearTr;
-static  DdNode  *empty;
+extern DD_TLS  int     *zdd_entry;
+extern DD_TLS  int     zddTotalNumberSwapping;
+static DD_TLS  int     zddTotalNumberLinearTr;
+static DD_TLS  DdNode  *empty;
 
 
 /*---------------------------------------------------------------------------*/
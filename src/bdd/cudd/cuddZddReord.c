@@ -105,11 +105,11 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddZddReord.c,v 1.47 2004/08/13 18:04:53 fabio Exp $";
 #endif
 
-int     *zdd_entry;
+DD_TLS int     *zdd_entry;
 
-int     zddTotalNumberSwapping;
+DD_TLS int     zddTotalNumberSwapping;
 
-static  DdNode  *empty;
+static DD_TLS  DdNode  *empty;
 
 
 /*---------------------------------------------------------------------------*/
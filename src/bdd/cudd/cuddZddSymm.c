@@ -96,11 +96,11 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddZddSymm.c,v 1.29 2004/08/13 18:04:54 fabio Exp $";
 #endif
 
-extern int      *zdd_entry;
+extern DD_TLS int      *zdd_entry;
 
-extern int      zddTotalNumberSwapping;
+extern DD_TLS int      zddTotalNumberSwapping;
 
-static DdNode   *empty;
+static DD_TLS DdNode   *empty;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
@@ -56,6 +56,7 @@ struct Gia_ParLlb_t_
     int         fUsePivots;    // use internal pivot variables
     int         fCluster;      // use partition clustering
     int         fSchedule;     // use cluster scheduling
+    int         nProcs;        // the number of threads
     int         fDumpReached;  // dump reached states into a file
     int         fVerbose;      // print verbose information
     int         fVeryVerbose;  // print dependency matrices
@@ -61,6 +61,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
     p->fUsePivots    =        0;
     p->fCluster      =        0;
     p->fSchedule     =        0;
+    p->nProcs        =        1;
     p->fDumpReached  =        0;
     p->fVerbose      =        0;
     p->fVeryVerbose  =        0;
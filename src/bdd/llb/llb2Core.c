@@ -38,6 +38,7 @@ struct Llb_Img_t_
     DdManager *     ddG;            // BDD manager
     DdManager *     ddR;            // BDD manager
     Vec_Ptr_t *     vDdMans;        // BDD managers for each partition
+    Vec_Ptr_t *     vDdClus;        // BDD managers for each cluster of partitions
     Vec_Ptr_t *     vRings;         // onion rings in ddR
 
     Vec_Int_t *     vDriRefs;       // driver references
@@ -333,7 +334,7 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
         }
 
         // compute the next states
-        bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
+        bNext = Llb_ImgComputeImage( p->pAig, p->vDdClus ? p->vDdClus : p->vDdMans, p->dd, bCurrent, 
             vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
             p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
         if ( bNext == NULL )
@@ -499,19 +500,35 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
 int Llb_CoreReachability( Llb_Img_t * p )
 {
     Vec_Ptr_t * vSupps, * vQuant0, * vQuant1;
-    int RetValue;
+    Vec_Int_t * vStart = p->pPars->fBackward ? p->vVarsNs : p->vVarsCs;
+    Vec_Int_t * vStop  = p->pPars->fBackward ? p->vVarsCs : p->vVarsNs;
+    int i, RetValue;
     // get supports and quantified variables
     if ( p->pPars->fBackward )
-    {
         Vec_PtrReverseOrder( p->vDdMans );
-        vSupps = Llb_ImgSupports( p->pAig, p->vDdMans, p->vVarsNs, p->vVarsCs, 0, p->pPars->fVeryVerbose );
-    }
-    else
-        vSupps = Llb_ImgSupports( p->pAig, p->vDdMans, p->vVarsCs, p->vVarsNs, 0, p->pPars->fVeryVerbose );
+    vSupps = Llb_ImgSupports( p->pAig, p->vDdMans, vStart, vStop, 0, p->pPars->fVeryVerbose );
     Llb_ImgSchedule( vSupps, &vQuant0, &vQuant1, p->pPars->fVeryVerbose );
     Vec_VecFree( (Vec_Vec_t *)vSupps );
     // remove variables
-    Llb_ImgQuantifyFirst( p->pAig, p->vDdMans, vQuant0, p->pPars->fVeryVerbose );
+    if ( p->pPars->nProcs > 1 )
+        Llb_PthQuantifyFirst( p->pAig, p->vDdMans, vQuant0, p->pPars->nProcs, p->pPars->fVeryVerbose );
+    else
+        Llb_ImgQuantifyFirst( p->pAig, p->vDdMans, vQuant0, p->pPars->fVeryVerbose );
+    // merge adjacent partitions into clusters
+    if ( p->pPars->fCluster )
+        p->vDdClus = Llb_PthCluster( p->pAig, p->vDdMans, vStart, vStop, p->pPars->nClusterMax, 
+            p->pPars->TimeTarget, p->pPars->nProcs, p->pPars->fVerbose );
+    if ( p->vDdClus )
+    {
+        Vec_VecFree( (Vec_Vec_t *)vQuant0 );
+        Vec_VecFree( (Vec_Vec_t *)vQuant1 );
+        vSupps = Llb_ImgSupports( p->pAig, p->vDdClus, vStart, vStop, 0, p->pPars->fVeryVerbose );
+        Llb_ImgSchedule( vSupps, &vQuant0, &vQuant1, p->pPars->fVeryVerbose );
+        Vec_VecFree( (Vec_Vec_t *)vSupps );
+        // the variables appearing only in one cluster are already quantified
+        for ( i = 0; i < Vec_PtrSize(p->vDdClus); i++ )
+            assert( Vec_IntSize((Vec_Int_t *)Vec_PtrEntry(vQuant0, i+1)) == 0 );
+    }
     // perform reachability
     RetValue = Llb_CoreReachability_int( p, vQuant0, vQuant1 );
     Vec_VecFree( (Vec_Vec_t *)vQuant0 );
@@ -652,6 +669,17 @@ void Llb_CoreStop( Llb_Img_t * p )
     DdManager * dd;
     DdNode * bTemp;
     int i;
+    if ( p->vDdClus )
+    Vec_PtrForEachEntry( DdManager *, p->vDdClus, dd, i )
+    {
+        // some clusters are the original partitions
+        if ( Vec_PtrFind(p->vDdMans, dd) >= 0 )
+            continue;
+        if ( dd->bFunc )
+            Cudd_RecursiveDeref( dd, dd->bFunc );
+        Extra_StopManager( dd );
+    }
+    Vec_PtrFreeP( &p->vDdClus );
     if ( p->vDdMans )
     Vec_PtrForEachEntry( DdManager *, p->vDdMans, dd, i )
     {
@@ -698,7 +726,10 @@ int Llb_CoreExperiment( Aig_Man_t * pInit, Aig_Man_t * pAig, Gia_ParLlb_t * pPar
 //    printf( "\n" );
 //    pPars->fVerbose = 1;
     p = Llb_CoreStart( pInit, pAig, pPars );
-    p->vDdMans = Llb_CoreConstructAll( pAig, vResult, p->vVarsNs, TimeTarget );
+    if ( pPars->nProcs > 1 )
+        p->vDdMans = Llb_PthConstructAll( pAig, vResult, p->vVarsNs, TimeTarget, pPars->nProcs );
+    else
+        p->vDdMans = Llb_CoreConstructAll( pAig, vResult, p->vVarsNs, TimeTarget );
     if ( p->vDdMans == NULL )
     {
         if ( !pPars->fSilent )
@@ -173,18 +173,21 @@ void Llb_ImgSchedule( Vec_Ptr_t * vSupps, Vec_Ptr_t ** pvQuant0, Vec_Ptr_t ** pv
 
   Synopsis    [Computes one partition in a separate BDD manager.]
 
-  Description []
+  Description [The nodes between the cuts (vNodes) and the upper cut
+  nodes that are not in the lower cut (vRange) are precomputed. The BDDs
+  of the nodes are stored in a local array rather than in the AIG, so
+  that several partitions can be computed concurrently.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-DdManager * Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper, abctime TimeTarget )
+DdManager * Llb_ImgPartitionNodes( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vNodes, Vec_Ptr_t * vRange, abctime TimeTarget )
 {
-    Vec_Ptr_t * vNodes, * vRange;
     Aig_Obj_t * pObj;
     DdManager * dd;
+    DdNode ** pBdds;
     DdNode * bBdd0, * bBdd1, * bProd, * bRes, * bTemp;
     int i;
 
@@ -192,40 +195,35 @@ DdManager * Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUp
     Cudd_AutodynEnable( dd,  CUDD_REORDER_SYMM_SIFT );
     dd->TimeStop = TimeTarget;
 
+    pBdds = ABC_CALLOC( DdNode *, Aig_ManObjNumMax(p) );
+    pBdds[Aig_ObjId(Aig_ManConst1(p))] = Cudd_ReadOne( dd );
     Vec_PtrForEachEntry( Aig_Obj_t *, vLower, pObj, i )
-        pObj->pData = Cudd_bddIthVar( dd, Aig_ObjId(pObj) );
+        pBdds[Aig_ObjId(pObj)] = Cudd_bddIthVar( dd, Aig_ObjId(pObj) );
 
-    vNodes = Llb_ManCutNodes( p, vLower, vUpper );
     Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
     {
-        bBdd0 = Cudd_NotCond( (DdNode *)Aig_ObjFanin0(pObj)->pData, Aig_ObjFaninC0(pObj) );
-        bBdd1 = Cudd_NotCond( (DdNode *)Aig_ObjFanin1(pObj)->pData, Aig_ObjFaninC1(pObj) );
-//        pObj->pData = Cudd_bddAnd( dd, bBdd0, bBdd1 );   Cudd_Ref( (DdNode *)pObj->pData );
-//        pObj->pData = Extra_bddAndTime( dd, bBdd0, bBdd1, TimeTarget );  
-        pObj->pData = Cudd_bddAnd( dd, bBdd0, bBdd1 );  
-        if ( pObj->pData == NULL )
+        bBdd0 = Cudd_NotCond( pBdds[Aig_ObjFaninId0(pObj)], Aig_ObjFaninC0(pObj) );
+        bBdd1 = Cudd_NotCond( pBdds[Aig_ObjFaninId1(pObj)], Aig_ObjFaninC1(pObj) );
+        pBdds[Aig_ObjId(pObj)] = Cudd_bddAnd( dd, bBdd0, bBdd1 );  
+        if ( pBdds[Aig_ObjId(pObj)] == NULL )
         {
             Cudd_Quit( dd );
-            Vec_PtrFree( vNodes );
+            ABC_FREE( pBdds );
             return NULL;
         }
-        Cudd_Ref( (DdNode *)pObj->pData );
+        Cudd_Ref( pBdds[Aig_ObjId(pObj)] );
     }
 
-    vRange = Llb_ManCutRange( p, vLower, vUpper );
     bRes   = Cudd_ReadOne(dd);   Cudd_Ref( bRes );
     Vec_PtrForEachEntry( Aig_Obj_t *, vRange, pObj, i )
     {
         assert( Aig_ObjIsNode(pObj) );
-        bProd = Cudd_bddXnor( dd, Cudd_bddIthVar(dd, Aig_ObjId(pObj)), (DdNode *)pObj->pData );   Cudd_Ref( bProd );
-//        bRes  = Cudd_bddAnd( dd, bTemp = bRes, bProd ); Cudd_Ref( bRes );
-//        bRes  = Extra_bddAndTime( dd, bTemp = bRes, bProd, TimeTarget );  
+        bProd = Cudd_bddXnor( dd, Cudd_bddIthVar(dd, Aig_ObjId(pObj)), pBdds[Aig_ObjId(pObj)] );   Cudd_Ref( bProd );
         bRes  = Cudd_bddAnd( dd, bTemp = bRes, bProd );  
         if ( bRes == NULL )
         {
             Cudd_Quit( dd );
-            Vec_PtrFree( vRange );
-            Vec_PtrFree( vNodes );
+            ABC_FREE( pBdds );
             return NULL;
         }        
         Cudd_Ref( bRes );
@@ -233,17 +231,25 @@ DdManager * Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUp
         Cudd_RecursiveDeref( dd, bProd );
     }
     Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
-        Cudd_RecursiveDeref( dd, (DdNode *)pObj->pData );
+        Cudd_RecursiveDeref( dd, pBdds[Aig_ObjId(pObj)] );
+    ABC_FREE( pBdds );
 
-    Vec_PtrFree( vRange );
-    Vec_PtrFree( vNodes );
     Cudd_AutodynDisable( dd );
-//    Cudd_RecursiveDeref( dd, bRes );
-//    Extra_StopManager( dd );
     dd->bFunc = bRes;
     dd->TimeStop = 0;
     return dd;
 }
+DdManager * Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper, abctime TimeTarget )
+{
+    Vec_Ptr_t * vNodes, * vRange;
+    DdManager * dd;
+    vNodes = Llb_ManCutNodes( p, vLower, vUpper );
+    vRange = Llb_ManCutRange( p, vLower, vUpper );
+    dd = Llb_ImgPartitionNodes( p, vLower, vNodes, vRange, TimeTarget );
+    Vec_PtrFree( vRange );
+    Vec_PtrFree( vNodes );
+    return dd;
+}
 
 /**Function*************************************************************
 
@@ -285,44 +291,49 @@ DdNode * Llb_ImgComputeCube( Aig_Man_t * pAig, Vec_Int_t * vNodeIds, DdManager *
   SeeAlso     []
 
 ***********************************************************************/
+void Llb_ImgQuantifyOne( Aig_Man_t * pAig, DdManager * dd, Vec_Int_t * vQuant, int fVerbose )
+{
+    DdNode * bProd, * bRes, * bTemp;
+    // remember unquantified ones
+    assert( dd->bFunc2 == NULL );
+    dd->bFunc2 = dd->bFunc;   Cudd_Ref( dd->bFunc2 );
+
+    Cudd_AutodynEnable( dd, CUDD_REORDER_SYMM_SIFT );
+
+    bRes = dd->bFunc;
+    if ( fVerbose )
+        Abc_Print( 1, "Init =%5d. ", Cudd_DagSize(bRes) );
+    bProd = Llb_ImgComputeCube( pAig, vQuant, dd );   Cudd_Ref( bProd );
+    bRes  = Cudd_bddExistAbstract( dd, bTemp = bRes, bProd );                          Cudd_Ref( bRes );
+    Cudd_RecursiveDeref( dd, bTemp );
+    Cudd_RecursiveDeref( dd, bProd );
+    dd->bFunc = bRes;
+
+    Cudd_AutodynDisable( dd );
+
+    if ( fVerbose )
+        Abc_Print( 1, "Quant =%5d. ", Cudd_DagSize(bRes) );
+    Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 100 );
+    if ( fVerbose ) 
+        Abc_Print( 1, "Reo = %5d. ", Cudd_DagSize(bRes) );
+    Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 100 );
+    if ( fVerbose ) 
+        Abc_Print( 1, "Reo = %5d.  ", Cudd_DagSize(bRes) );
+    if ( fVerbose ) 
+        Abc_Print( 1, "Supp = %3d.  ", Cudd_SupportSize(dd, bRes) );
+}
 void Llb_ImgQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant0, int fVerbose )
 {
     DdManager * dd;
-    DdNode * bProd, * bRes, * bTemp;
     int i;
     abctime clk = Abc_Clock();
     Vec_PtrForEachEntry( DdManager *, vDdMans, dd, i )
     {
-        // remember unquantified ones
-        assert( dd->bFunc2 == NULL );
-        dd->bFunc2 = dd->bFunc;   Cudd_Ref( dd->bFunc2 );
-
-        Cudd_AutodynEnable( dd, CUDD_REORDER_SYMM_SIFT );
-
-        bRes = dd->bFunc;
-        if ( fVerbose )
-            Abc_Print( 1, "Part %2d : Init =%5d. ", i, Cudd_DagSize(bRes) );
-        bProd = Llb_ImgComputeCube( pAig, (Vec_Int_t *)Vec_PtrEntry(vQuant0, i+1), dd );   Cudd_Ref( bProd );
-        bRes  = Cudd_bddExistAbstract( dd, bTemp = bRes, bProd );                          Cudd_Ref( bRes );
-        Cudd_RecursiveDeref( dd, bTemp );
-        Cudd_RecursiveDeref( dd, bProd );
-        dd->bFunc = bRes;
-
-        Cudd_AutodynDisable( dd );
-
         if ( fVerbose )
-            Abc_Print( 1, "Quant =%5d. ", Cudd_DagSize(bRes) );
-        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 100 );
-        if ( fVerbose ) 
-            Abc_Print( 1, "Reo = %5d. ", Cudd_DagSize(bRes) );
-        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 100 );
-        if ( fVerbose ) 
-            Abc_Print( 1, "Reo = %5d.  ", Cudd_DagSize(bRes) );
-        if ( fVerbose ) 
-            Abc_Print( 1, "Supp = %3d.  ", Cudd_SupportSize(dd, bRes) );
+            Abc_Print( 1, "Part %2d : ", i );
+        Llb_ImgQuantifyOne( pAig, dd, (Vec_Int_t *)Vec_PtrEntry(vQuant0, i+1), fVerbose );
         if ( fVerbose ) 
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
-
     }
 }
 
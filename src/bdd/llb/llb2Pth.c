@@ -0,0 +1,527 @@
+/**CFile****************************************************************
+
+  FileName    [llb2Pth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Concurrent computation and clustering of partitions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: llb2Pth.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+extern Vec_Ptr_t * Llb_ManCutNodes( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
+extern Vec_Ptr_t * Llb_ManCutRange( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
+
+#define LLB_PTH_THR_MAX 100
+
+// the procedure performing one job
+typedef void (*Llb_PthJob_t)( void * pData, int iJob );
+
+// the jobs shared by the threads
+typedef struct Llb_PthRun_t_ Llb_PthRun_t;
+struct Llb_PthRun_t_
+{
+    Llb_PthJob_t    pFunc;          // the procedure performing one job
+    void *          pData;          // the data of all jobs
+    int             nJobs;          // the number of jobs
+    int             iJobNext;       // the next job to be taken
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;          // protects the next job
+#endif
+};
+
+// computation of the partitions
+typedef struct Llb_PthPart_t_ Llb_PthPart_t;
+struct Llb_PthPart_t_
+{
+    Aig_Man_t *     pAig;           // AIG manager
+    Vec_Ptr_t *     vNodes;         // internal nodes of each partition
+    Vec_Ptr_t *     vRanges;        // upper cut nodes of each partition
+    Vec_Ptr_t *     vResult;        // the cuts
+    Vec_Int_t *     vVarsNs;        // next state variables
+    Vec_Ptr_t *     vDdMans;        // the resulting managers
+    abctime         TimeTarget;     // the time to stop
+};
+
+// quantification of the partitions
+typedef struct Llb_PthQuant_t_ Llb_PthQuant_t;
+struct Llb_PthQuant_t_
+{
+    Aig_Man_t *     pAig;           // AIG manager
+    Vec_Ptr_t *     vDdMans;        // the partitions
+    Vec_Ptr_t *     vQuant0;        // the variables to quantify
+};
+
+// clustering of the partitions
+typedef struct Llb_PthClu_t_ Llb_PthClu_t;
+struct Llb_PthClu_t_
+{
+    Aig_Man_t *     pAig;           // AIG manager
+    Vec_Ptr_t *     vDdMans;        // the current clusters
+    Vec_Ptr_t *     vSupps;         // the supports of the clusters
+    Vec_Int_t *     vCounts;        // the number of supports with each variable
+    Vec_Int_t *     vPairs;         // the pairs of clusters merged in this round
+    Vec_Ptr_t *     vDdRes;         // the merged clusters (NULL if failed)
+    Vec_Ptr_t *     vSuppRes;       // the supports of the merged clusters
+    int             nSizeMax;       // the largest cluster
+    abctime         TimeTarget;     // the time to stop
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the jobs using several threads.]
+
+  Description [The jobs are taken from the shared counter in the order
+  of their numbers. The calling thread performs the jobs too.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Llb_PthWorkerThread( void * pArg )
+{
+    Llb_PthRun_t * p = (Llb_PthRun_t *)pArg;
+    int iJob, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock(&p->Mutex);  assert( status == 0 );
+        iJob = p->iJobNext++;
+        status = pthread_mutex_unlock(&p->Mutex);  assert( status == 0 );
+        if ( iJob >= p->nJobs )
+            break;
+        p->pFunc( p->pData, iJob );
+    }
+    return NULL;
+}
+void Llb_PthRunJobs( Llb_PthJob_t pFunc, void * pData, int nJobs, int nProcs )
+{
+    pthread_t WorkerThread[LLB_PTH_THR_MAX];
+    Llb_PthRun_t Run;
+    int i, status;
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, nJobs), LLB_PTH_THR_MAX );
+    if ( nProcs < 2 )
+    {
+        for ( i = 0; i < nJobs; i++ )
+            pFunc( pData, i );
+        return;
+    }
+    Run.pFunc    = pFunc;
+    Run.pData    = pData;
+    Run.nJobs    = nJobs;
+    Run.iJobNext = 0;
+    status = pthread_mutex_init( &Run.Mutex, NULL );  assert( status == 0 );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_PthWorkerThread, (void *)&Run );
+        assert( status == 0 );
+    }
+    Llb_PthWorkerThread( (void *)&Run );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    status = pthread_mutex_destroy( &Run.Mutex );  assert( status == 0 );
+}
+#else
+void Llb_PthRunJobs( Llb_PthJob_t pFunc, void * pData, int nJobs, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nJobs; i++ )
+        pFunc( pData, i );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the partitions concurrently.]
+
+  Description [Same as Llb_CoreConstructAll(). The nodes of each
+  partition are collected beforehand because the traversal uses the
+  traversal IDs of the AIG. After that, the partitions are computed in
+  their own BDD managers, which are independent of each other.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_PthConstructOne( void * pData, int iJob )
+{
+    Llb_PthPart_t * p = (Llb_PthPart_t *)pData;
+    DdManager * dd;
+    if ( iJob < Vec_PtrSize(p->vResult) - 1 )
+        dd = Llb_ImgPartitionNodes( p->pAig, (Vec_Ptr_t *)Vec_PtrEntry(p->vResult, iJob),
+            (Vec_Ptr_t *)Vec_PtrEntry(p->vNodes, iJob), (Vec_Ptr_t *)Vec_PtrEntry(p->vRanges, iJob), p->TimeTarget );
+    else
+        dd = Llb_DriverLastPartition( p->pAig, p->vVarsNs, p->TimeTarget );
+    Vec_PtrWriteEntry( p->vDdMans, iJob, dd );
+}
+Vec_Ptr_t * Llb_PthConstructAll( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Vec_Int_t * vVarsNs, abctime TimeTarget, int nProcs )
+{
+    Llb_PthPart_t Data, * p = &Data;
+    Vec_Ptr_t * vLower, * vUpper;
+    DdManager * dd;
+    int i, fFailed = 0;
+    p->pAig       = pAig;
+    p->vResult    = vResult;
+    p->vVarsNs    = vVarsNs;
+    p->TimeTarget = TimeTarget;
+    p->vDdMans    = Vec_PtrStart( Vec_PtrSize(vResult) );
+    p->vNodes     = Vec_PtrStart( Vec_PtrSize(vResult) );
+    p->vRanges    = Vec_PtrStart( Vec_PtrSize(vResult) );
+    for ( i = 0; i < Vec_PtrSize(vResult) - 1; i++ )
+    {
+        vLower = (Vec_Ptr_t *)Vec_PtrEntry( vResult, i );
+        vUpper = (Vec_Ptr_t *)Vec_PtrEntry( vResult, i+1 );
+        Vec_PtrWriteEntry( p->vNodes,  i, Llb_ManCutNodes(pAig, vLower, vUpper) );
+        Vec_PtrWriteEntry( p->vRanges, i, Llb_ManCutRange(pAig, vLower, vUpper) );
+    }
+    Llb_PthRunJobs( Llb_PthConstructOne, p, Vec_PtrSize(vResult), nProcs );
+    for ( i = 0; i < Vec_PtrSize(vResult) - 1; i++ )
+    {
+        Vec_PtrFree( (Vec_Ptr_t *)Vec_PtrEntry(p->vNodes, i) );
+        Vec_PtrFree( (Vec_Ptr_t *)Vec_PtrEntry(p->vRanges, i) );
+    }
+    Vec_PtrFree( p->vNodes );
+    Vec_PtrFree( p->vRanges );
+    // check if some partitions have timed out
+    Vec_PtrForEachEntry( DdManager *, p->vDdMans, dd, i )
+        fFailed |= (dd == NULL);
+    if ( !fFailed )
+        return p->vDdMans;
+    Vec_PtrForEachEntry( DdManager *, p->vDdMans, dd, i )
+    {
+        if ( dd == NULL )
+            continue;
+        if ( dd->bFunc )
+            Cudd_RecursiveDeref( dd, dd->bFunc );
+        Extra_StopManager( dd );
+    }
+    Vec_PtrFree( p->vDdMans );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Quantifies the unique variables of the partitions concurrently.]
+
+  Description [Same as Llb_ImgQuantifyFirst().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_PthQuantifyOne( void * pData, int iJob )
+{
+    Llb_PthQuant_t * p = (Llb_PthQuant_t *)pData;
+    Llb_ImgQuantifyOne( p->pAig, (DdManager *)Vec_PtrEntry(p->vDdMans, iJob), (Vec_Int_t *)Vec_PtrEntry(p->vQuant0, iJob+1), 0 );
+}
+void Llb_PthQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant0, int nProcs, int fVerbose )
+{
+    Llb_PthQuant_t Data, * p = &Data;
+    DdManager * dd;
+    int i;
+    abctime clk = Abc_Clock();
+    p->pAig    = pAig;
+    p->vDdMans = vDdMans;
+    p->vQuant0 = vQuant0;
+    Llb_PthRunJobs( Llb_PthQuantifyOne, p, Vec_PtrSize(vDdMans), nProcs );
+    if ( !fVerbose )
+        return;
+    Vec_PtrForEachEntry( DdManager *, vDdMans, dd, i )
+        Abc_Print( 1, "Part %2d : Init =%5d. Quant =%5d. Supp = %3d.\n",
+            i, Cudd_DagSize(dd->bFunc2), Cudd_DagSize(dd->bFunc), Cudd_SupportSize(dd, dd->bFunc) );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the support of the partition as an array of variables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Llb_PthSupport( DdManager * dd )
+{
+    Vec_Int_t * vSupp = Vec_IntAlloc( 100 );
+    DdNode * bSupp, * bTemp;
+    bSupp = Cudd_Support( dd, dd->bFunc );  Cudd_Ref( bSupp );
+    for ( bTemp = bSupp; bTemp != Cudd_ReadOne(dd); bTemp = cuddT(bTemp) )
+        Vec_IntPush( vSupp, bTemp->index );
+    Cudd_RecursiveDeref( dd, bSupp );
+    return vSupp;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two adjacent clusters.]
+
+  Description [The functions are transferred into a new manager, which
+  starts with the variable order of the first one. The variables that do
+  not appear in other clusters, in the starting and in the final states
+  are quantified during the conjunction. The clusters of the other pairs
+  have no such variables in common with this pair, so the pairs can be
+  merged concurrently. The result is NULL if the resulting BDD exceeds
+  the limit or the time is out.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_PthMergeOne( void * pData, int iJob )
+{
+    Llb_PthClu_t * p = (Llb_PthClu_t *)pData;
+    int iClu0 = Vec_IntEntry( p->vPairs, 2*iJob );
+    int iClu1 = Vec_IntEntry( p->vPairs, 2*iJob+1 );
+    DdManager * dd0 = (DdManager *)Vec_PtrEntry( p->vDdMans, iClu0 );
+    DdManager * dd1 = (DdManager *)Vec_PtrEntry( p->vDdMans, iClu1 );
+    Vec_Int_t * vSupp0 = (Vec_Int_t *)Vec_PtrEntry( p->vSupps, iClu0 );
+    Vec_Int_t * vSupp1 = (Vec_Int_t *)Vec_PtrEntry( p->vSupps, iClu1 );
+    Vec_Int_t * vMarks, * vQuant;
+    DdManager * dd;
+    DdNode * bFunc0, * bFunc1, * bCube, * bRes = NULL;
+    int i, iVar;
+    // collect the variables to quantify
+    vMarks = Vec_IntStart( Cudd_ReadSize(dd0) );
+    vQuant = Vec_IntAlloc( 100 );
+    Vec_IntForEachEntry( vSupp0, iVar, i )
+        Vec_IntAddToEntry( vMarks, iVar, 1 );
+    Vec_IntForEachEntry( vSupp1, iVar, i )
+        Vec_IntAddToEntry( vMarks, iVar, 1 );
+    Vec_IntForEachEntry( vSupp0, iVar, i )
+        if ( Vec_IntEntry(vMarks, iVar) == Vec_IntEntry(p->vCounts, iVar) )
+            Vec_IntPush( vQuant, iVar );
+    Vec_IntForEachEntry( vSupp1, iVar, i )
+        if ( Vec_IntEntry(vMarks, iVar) == 1 && Vec_IntEntry(p->vCounts, iVar) == 1 )
+            Vec_IntPush( vQuant, iVar );
+    Vec_IntFree( vMarks );
+    // compute the product in the new manager
+    dd = Cudd_Init( Cudd_ReadSize(dd0), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    Cudd_ShuffleHeap( dd, dd0->invperm );
+    Cudd_AutodynEnable( dd, CUDD_REORDER_SYMM_SIFT );
+    dd->TimeStop = p->TimeTarget;
+    bFunc0 = Cudd_bddTransfer( dd0, dd, dd0->bFunc );
+    if ( bFunc0 != NULL )
+    {
+        Cudd_Ref( bFunc0 );
+        bFunc1 = Cudd_bddTransfer( dd1, dd, dd1->bFunc );
+        if ( bFunc1 != NULL )
+        {
+            Cudd_Ref( bFunc1 );
+            bCube = Llb_ImgComputeCube( p->pAig, vQuant, dd );  Cudd_Ref( bCube );
+            bRes  = Cudd_bddAndAbstractLimit( dd, bFunc0, bFunc1, bCube, 2 * p->nSizeMax );
+            if ( bRes != NULL )
+                Cudd_Ref( bRes );
+            Cudd_RecursiveDeref( dd, bCube );
+            Cudd_RecursiveDeref( dd, bFunc1 );
+        }
+        Cudd_RecursiveDeref( dd, bFunc0 );
+    }
+    Vec_IntFree( vQuant );
+    if ( bRes != NULL && Cudd_DagSize(bRes) > p->nSizeMax )
+    {
+        Cudd_RecursiveDeref( dd, bRes );
+        bRes = NULL;
+    }
+    if ( bRes == NULL )
+    {
+        Extra_StopManager( dd );
+        return;
+    }
+    Cudd_AutodynDisable( dd );
+    dd->bFunc = bRes;
+    dd->TimeStop = 0;
+    Vec_PtrWriteEntry( p->vDdRes, iJob, dd );
+    Vec_PtrWriteEntry( p->vSuppRes, iJob, Llb_PthSupport(dd) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Clusters the partitions.]
+
+  Description [The clusters are merged in a balanced tree. In each round,
+  the adjacent clusters are paired and the pairs are merged concurrently
+  by Llb_PthMergeOne(). When the merged cluster exceeds the size limit,
+  the larger cluster of the pair is not merged any more. The clustering
+  stops when there is nothing to merge. The partitions should already
+  be free of the variables appearing only in them. Returns NULL if no
+  clusters have been merged. Otherwise, returns the clusters, some of
+  which may be the original partitions, while others are in new managers
+  without the unquantified copy (bFunc2).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_PthClusterFree( Vec_Ptr_t * vDdMans, DdManager * dd )
+{
+    if ( Vec_PtrFind(vDdMans, dd) >= 0 )
+        return;
+    Cudd_RecursiveDeref( dd, dd->bFunc );
+    Extra_StopManager( dd );
+}
+Vec_Ptr_t * Llb_PthCluster( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Int_t * vStart, Vec_Int_t * vStop, int nSizeMax, abctime TimeTarget, int nProcs, int fVerbose )
+{
+    Llb_PthClu_t Data, * p = &Data;
+    Vec_Int_t * vFrozen, * vSupp;
+    DdManager * dd, * dd0, * dd1;
+    int i, k, iVar, iClu0, iClu1, nRounds = 0, nMerges = 0;
+    abctime clk = Abc_Clock();
+    memset( p, 0, sizeof(Llb_PthClu_t) );
+    p->pAig       = pAig;
+    p->nSizeMax   = nSizeMax;
+    p->TimeTarget = TimeTarget;
+    p->vDdMans    = Vec_PtrDup( vDdMans );
+    p->vSupps     = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+    p->vCounts    = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    p->vPairs     = Vec_IntAlloc( Vec_PtrSize(vDdMans) );
+    p->vDdRes     = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+    p->vSuppRes   = Vec_PtrAlloc( Vec_PtrSize(vDdMans) );
+    vFrozen       = Vec_IntStart( Vec_PtrSize(vDdMans) );
+    // count the occurrences of the variables
+    Vec_IntForEachEntry( vStart, iVar, i )
+        Vec_IntAddToEntry( p->vCounts, iVar, 1 );
+    Vec_IntForEachEntry( vStop, iVar, i )
+        Vec_IntAddToEntry( p->vCounts, iVar, 1 );
+    Vec_PtrForEachEntry( DdManager *, p->vDdMans, dd, i )
+    {
+        vSupp = Llb_PthSupport( dd );
+        Vec_IntForEachEntry( vSupp, iVar, k )
+            Vec_IntAddToEntry( p->vCounts, iVar, 1 );
+        Vec_PtrPush( p->vSupps, vSupp );
+        // the partition is frozen if it is too large to be merged
+        if ( Cudd_DagSize(dd->bFunc) > nSizeMax )
+            Vec_IntWriteEntry( vFrozen, i, 1 );
+    }
+    while ( Vec_PtrSize(p->vDdMans) > 1 )
+    {
+        // pair the adjacent clusters
+        Vec_IntClear( p->vPairs );
+        for ( i = 0; i + 1 < Vec_PtrSize(p->vDdMans); i++ )
+            if ( !Vec_IntEntry(vFrozen, i) && !Vec_IntEntry(vFrozen, i+1) )
+                Vec_IntPushTwo( p->vPairs, i, i+1 ), i++;
+        if ( Vec_IntSize(p->vPairs) == 0 )
+            break;
+        // merge the pairs
+        Vec_PtrFill( p->vDdRes,   Vec_IntSize(p->vPairs)/2, NULL );
+        Vec_PtrFill( p->vSuppRes, Vec_IntSize(p->vPairs)/2, NULL );
+        Llb_PthRunJobs( Llb_PthMergeOne, p, Vec_IntSize(p->vPairs)/2, nProcs );
+        // update the clusters
+        for ( k = 0; k < Vec_IntSize(p->vPairs)/2; k++ )
+        {
+            iClu0 = Vec_IntEntry( p->vPairs, 2*k );
+            iClu1 = Vec_IntEntry( p->vPairs, 2*k+1 );
+            dd0 = (DdManager *)Vec_PtrEntry( p->vDdMans, iClu0 );
+            dd1 = (DdManager *)Vec_PtrEntry( p->vDdMans, iClu1 );
+            dd  = (DdManager *)Vec_PtrEntry( p->vDdRes, k );
+            if ( dd == NULL )
+            {
+                if ( Cudd_DagSize(dd0->bFunc) >= Cudd_DagSize(dd1->bFunc) )
+                    Vec_IntWriteEntry( vFrozen, iClu0, 1 );
+                else
+                    Vec_IntWriteEntry( vFrozen, iClu1, 1 );
+                continue;
+            }
+            Vec_IntForEachEntry( (Vec_Int_t *)Vec_PtrEntry(p->vSupps, iClu0), iVar, i )
+                Vec_IntAddToEntry( p->vCounts, iVar, -1 );
+            Vec_IntForEachEntry( (Vec_Int_t *)Vec_PtrEntry(p->vSupps, iClu1), iVar, i )
+                Vec_IntAddToEntry( p->vCounts, iVar, -1 );
+            Vec_IntForEachEntry( (Vec_Int_t *)Vec_PtrEntry(p->vSuppRes, k), iVar, i )
+                Vec_IntAddToEntry( p->vCounts, iVar, 1 );
+            Llb_PthClusterFree( vDdMans, dd0 );
+            Llb_PthClusterFree( vDdMans, dd1 );
+            Vec_IntFree( (Vec_Int_t *)Vec_PtrEntry(p->vSupps, iClu0) );
+            Vec_IntFree( (Vec_Int_t *)Vec_PtrEntry(p->vSupps, iClu1) );
+            Vec_PtrWriteEntry( p->vDdMans, iClu0, dd );
+            Vec_PtrWriteEntry( p->vSupps,  iClu0, Vec_PtrEntry(p->vSuppRes, k) );
+            Vec_PtrWriteEntry( p->vDdMans, iClu1, NULL );
+            Vec_PtrWriteEntry( p->vSupps,  iClu1, NULL );
+            nMerges++;
+        }
+        // remove the merged clusters
+        for ( i = k = 0; i < Vec_PtrSize(p->vDdMans); i++ )
+        {
+            if ( Vec_PtrEntry(p->vDdMans, i) == NULL )
+                continue;
+            Vec_PtrWriteEntry( p->vDdMans, k, Vec_PtrEntry(p->vDdMans, i) );
+            Vec_PtrWriteEntry( p->vSupps,  k, Vec_PtrEntry(p->vSupps, i) );
+            Vec_IntWriteEntry( vFrozen,    k, Vec_IntEntry(vFrozen, i) );
+            k++;
+        }
+        Vec_PtrShrink( p->vDdMans, k );
+        Vec_PtrShrink( p->vSupps, k );
+        Vec_IntShrink( vFrozen, k );
+        nRounds++;
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "Round %2d : Clusters = %3d. Sizes =", nRounds, Vec_PtrSize(p->vDdMans) );
+            Vec_PtrForEachEntry( DdManager *, p->vDdMans, dd, i )
+                Abc_Print( 1, " %d%s", Cudd_DagSize(dd->bFunc), Vec_IntEntry(vFrozen, i) ? "*" : "" );
+            Abc_Print( 1, "\n" );
+        }
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Merged %d pairs of partitions into %d clusters in %d rounds.  ", nMerges, Vec_PtrSize(p->vDdMans), nRounds );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_VecFree( (Vec_Vec_t *)p->vSupps );
+    Vec_IntFree( p->vCounts );
+    Vec_IntFree( p->vPairs );
+    Vec_PtrFree( p->vDdRes );
+    Vec_PtrFree( p->vSuppRes );
+    Vec_IntFree( vFrozen );
+    if ( nMerges == 0 )
+        Vec_PtrFreeP( &p->vDdMans );
+    return p->vDdMans;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -167,12 +167,19 @@ extern DdManager *     Llb_DriverLastPartition( Aig_Man_t * p, Vec_Int_t * vVars
 /*=== llb2Image.c ======================================================*/
 extern Vec_Ptr_t *     Llb_ImgSupports( Aig_Man_t * p, Vec_Ptr_t * vDdMans, Vec_Int_t * vStart, Vec_Int_t * vStop, int fAddPis, int fVerbose );
 extern void            Llb_ImgSchedule( Vec_Ptr_t * vSupps, Vec_Ptr_t ** pvQuant0, Vec_Ptr_t ** pvQuant1, int fVerbose );
+extern DdManager *     Llb_ImgPartitionNodes( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vNodes, Vec_Ptr_t * vRange, abctime TimeTarget );
 extern DdManager *     Llb_ImgPartition( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper, abctime TimeTarget );
+extern DdNode *        Llb_ImgComputeCube( Aig_Man_t * pAig, Vec_Int_t * vNodeIds, DdManager * dd );
+extern void            Llb_ImgQuantifyOne( Aig_Man_t * pAig, DdManager * dd, Vec_Int_t * vQuant, int fVerbose );
 extern void            Llb_ImgQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant0, int fVerbose );
 extern void            Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans );
 extern DdNode *        Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
                            Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
                            abctime TimeTarget, int fBackward, int fReorder, int fVerbose );
+/*=== llb2Pth.c ======================================================*/
+extern Vec_Ptr_t *     Llb_PthConstructAll( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Vec_Int_t * vVarsNs, abctime TimeTarget, int nProcs );
+extern void            Llb_PthQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Ptr_t * vQuant0, int nProcs, int fVerbose );
+extern Vec_Ptr_t *     Llb_PthCluster( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, Vec_Int_t * vStart, Vec_Int_t * vStop, int nSizeMax, abctime TimeTarget, int nProcs, int fVerbose );
 
 extern DdManager *     Llb_NonlinImageStart( Aig_Man_t * pAig, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vRoots, int * pVars2Q, int * pOrder, int fFirst, abctime TimeTarget );
 extern DdNode *        Llb_NonlinImageCompute( DdNode * bCurrent, int fReorder, int fDrop, int fVerbose, int * pOrder );
@@ -2564,47 +2564,50 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
 #define PAR_THR_MAX 100
 typedef struct Ifn_ThData_t_
 {
-    Ifn_Ntk_t * pNtk;    // network
-    word        pTruth[DAU_MAX_WORD];
-    word        pConfig[10]; // configuration data
-    int         nConfigWords;// configuration data word count
-    int         nVars;   // support
-    int         Id;      // object
-    int         nConfls; // conflicts
-    int         Result;  // result
-    int         Status;  // state
-    abctime     clkUsed; // total runtime
+    If_DsdMan_t *     p;         // DSD manager
+    Ifn_Ntk_t *       pNtk;      // network
+    pthread_mutex_t * pMutex;    // protects the next object
+    int *             piNext;    // the next object to be matched
+    int               nInputs;   // skip objects with smaller support
+    int               nConfls;   // conflicts
+    Vec_Str_t *       vResults;  // results of matching (-1 if skipped)
+    ProgressBar *     pProgress; // progress bar (updated by the main thread)
+    abctime           clkUsed;   // total runtime
 } Ifn_ThData_t;
 void * Ifn_WorkerThread( void * pArg )
 {
     Ifn_ThData_t * pThData = (Ifn_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->Status;
+    If_DsdMan_t * p = pThData->p;
+    word pTruth[DAU_MAX_WORD], * pConfig;
+    int k, nVars;
     abctime clk;
     while ( 1 )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-            pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
+        pthread_mutex_lock( pThData->pMutex );
+        k = (*pThData->piNext)++;
+        pthread_mutex_unlock( pThData->pMutex );
+        if ( k >= Vec_PtrSize(&p->vObjs) )
+            break;
+        if ( pThData->pProgress && (k & 0xFF) == 0 )
+            Extra_ProgressBarUpdate( pThData->pProgress, k, NULL );
+        nVars = If_DsdObjSuppSize( If_DsdVecObj(&p->vObjs, k) );
+        if ( pThData->nInputs && nVars < pThData->nInputs )
+            continue;
         clk = Abc_Clock();
-        memset( pThData->pConfig, 0, sizeof(word) * pThData->nConfigWords );
-        pThData->Result = Ifn_NtkMatch( pThData->pNtk, pThData->pTruth, pThData->nVars, pThData->nConfls, 0, 0, pThData->pConfig );
+        // each object has its own place in the array of configurations
+        pConfig = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * k );
+        memset( pConfig, 0, sizeof(word) * p->nConfigWords );
+        If_DsdManComputeTruthPtr( p, Abc_Var2Lit(k, 0), NULL, pTruth );
+        Vec_StrWriteEntry( pThData->vResults, k, (char)Ifn_NtkMatch(pThData->pNtk, pTruth, nVars, pThData->nConfls, 0, 0, pConfig) );
         pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
     }
-    assert( 0 );
     return NULL;
 }
 void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int nInputs, int fVerbose )
 {
     int fVeryVerbose = 0;
     ProgressBar * pProgress = NULL;
-    int i, k, nVars, LutSize;
+    int i, LutSize;
     abctime clk = Abc_Clock();
     Ifn_Ntk_t * pNtk;
     If_DsdObj_t * pObj;
@@ -2657,84 +2660,50 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
     pProgress = Extra_ProgressBarStart( stdout, Vec_PtrSize(&p->vObjs) );
 
     // perform concurrent solving
+    // (the threads take the objects one at a time from the shared counter;
+    // each object is matched independently, so the results do not depend on the order)
     {
         pthread_t WorkerThread[PAR_THR_MAX];
         Ifn_ThData_t ThData[PAR_THR_MAX];
-        abctime clk, clkUsed = 0;
-        int status, fRunning = 1, iCurrentObj = p->nObjsPrev;
-        // start the threads
+        pthread_mutex_t Mutex;
+        Vec_Str_t * vResults = Vec_StrAlloc( Vec_PtrSize(&p->vObjs) );
+        int status, Result, iNext = p->nObjsPrev;
+        Vec_StrFill( vResults, Vec_PtrSize(&p->vObjs), (char)-1 );
+        status = pthread_mutex_init( &Mutex, NULL );  assert( status == 0 );
         for ( i = 0; i < nProcs; i++ )
         {
-            ThData[i].pNtk     = Ifn_NtkParse( pStruct );
-            ThData[i].nVars    = -1;      // support
-            ThData[i].Id       = -1;      // object
-            ThData[i].nConfls  = nConfls; // conflicts
-            ThData[i].Result   = -1;      // result
-            ThData[i].Status   =  0;      // state
-            ThData[i].clkUsed  =  0;      // total runtime
-            ThData[i].nConfigWords = p->nConfigWords;
-            status = pthread_create( WorkerThread + i, NULL, Ifn_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+            ThData[i].p         = p;
+            ThData[i].pNtk      = Ifn_NtkParse( pStruct );
+            ThData[i].pMutex    = &Mutex;
+            ThData[i].piNext    = &iNext;
+            ThData[i].nInputs   = nInputs;
+            ThData[i].nConfls   = nConfls;
+            ThData[i].vResults  = vResults;
+            ThData[i].pProgress = i ? NULL : pProgress;
+            ThData[i].clkUsed   = 0;
         }
-        // run the threads
-        while ( fRunning || iCurrentObj < Vec_PtrSize(&p->vObjs) )
+        // the calling thread works as thread 0
+        for ( i = 1; i < nProcs; i++ )
         {
-            for ( i = 0; i < nProcs; i++ )
-            {
-                if ( ThData[i].Status )
-                    continue;
-                assert( ThData[i].Status == 0 );
-                if ( ThData[i].Id >= 0 )
-                {
-                    //printf( "Closing obj %d with Thread %d:\n", ThData[i].Id, i );
-                    assert( ThData[i].Result == 0 || ThData[i].Result == 1 );
-                    if ( ThData[i].Result == 0 )
-                        If_DsdVecObjSetMark( &p->vObjs, ThData[i].Id );
-                    else
-                    {
-                        word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * ThData[i].Id );
-                        memcpy( pTtWords, ThData[i].pConfig, sizeof(word) * p->nConfigWords );
-                    }
-                    ThData[i].Id     = -1;
-                    ThData[i].Result = -1;
-                }
-                for ( k = iCurrentObj; k < Vec_PtrSize(&p->vObjs); k++ )
-                {
-                    if ( (k & 0xFF) == 0 )
-                        Extra_ProgressBarUpdate( pProgress, k, NULL );
-                    pObj  = If_DsdVecObj( &p->vObjs, k );
-                    nVars = If_DsdObjSuppSize(pObj);
-                    if ( nInputs && nVars < nInputs )
-                        continue;
-                    clk = Abc_Clock();
-                    If_DsdManComputeTruthPtr( p, Abc_Var2Lit(k, 0), NULL, ThData[i].pTruth );
-                    clkUsed += Abc_Clock() - clk;
-                    ThData[i].nVars  = nVars;
-                    ThData[i].Id     =  k;
-                    ThData[i].Result = -1;
-                    ThData[i].Status =  1;
-                    //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
-                    iCurrentObj = k+1;
-                    break;
-                }
-            }
-            fRunning = 0;
-            for ( i = 0; i < nProcs; i++ )
-                if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
-                    fRunning = 1;
-            //printf( "fRunning %d\n", fRunning );
+            status = pthread_create( WorkerThread + i, NULL, Ifn_WorkerThread, (void *)(ThData + i) );
+            assert( status == 0 );
         }
-        // stop the threads
-        for ( i = 0; i < nProcs; i++ )
+        Ifn_WorkerThread( (void *)ThData );
+        for ( i = 1; i < nProcs; i++ )
         {
-            assert( ThData[i].Status == 0 );
-            ThData[i].Id = -1;
-            ThData[i].Status = 1;
-            ABC_FREE( ThData[i].pNtk );
+            status = pthread_join( WorkerThread[i], NULL );
+            assert( status == 0 );
         }
+        pthread_mutex_destroy( &Mutex );
+        // record the objects that cannot be implemented
+        Vec_StrForEachEntry( vResults, Result, i )
+            if ( Result == 0 )
+                If_DsdVecObjSetMark( &p->vObjs, i );
+        Vec_StrFree( vResults );
+        for ( i = 0; i < nProcs; i++ )
+            ABC_FREE( ThData[i].pNtk );
         if ( fVerbose )
         {
-            printf( "Main     : " );
-            Abc_PrintTime( 1, "Time", clkUsed );
             for ( i = 0; i < nProcs; i++ )
             {
                 printf( "Thread %d : ", i );
@@ -205,7 +205,7 @@ int Map_SuperLibDeriveFromGenlib( Mio_Library_t * pLib, int fVerbose )
         return 0;
 
     // compute supergates
-    vStr = Super_PrecomputeStr( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0 );
+    vStr = Super_PrecomputeStr( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 1, 0 );
     if ( vStr == NULL )
         return 0;
 
@@ -239,7 +239,7 @@ int Map_SuperLibDeriveFromGenlib2( Mio_Library_t * pLib, int fVerbose )
         return 0;
     // compute supergates
     pFileName = Extra_FileNameGenericAppend(Mio_LibraryReadName(pLib), ".super");
-    Super_Precompute( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 0, pFileName );
+    Super_Precompute( pLib, 5, 1, 100000000, 10000000, 10000000, 100, 1, 1, 0, pFileName );
     // assuming that it terminated successfully
     if ( Cmd_CommandExecute( pAbc, pFileName ) )
     {
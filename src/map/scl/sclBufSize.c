@@ -497,6 +497,8 @@ Abc_Ntk_t * Abc_SclBufferingPerform( Abc_Ntk_t * pNtk, SC_Lib * pLib, SC_BusPars
     if ( !Abc_SclCheckNtk( pNtk, 0 ) )
         return NULL;
     Abc_SclReportDupFanins( pNtk );
+    // the corners have the same cells, so buffering uses the slowest one
+    pLib = Abc_SclFindWorstCorner( pLib, pNtk, pPars->fUseWireLoads, pPars->fVerbose );
     Abc_SclMioGates2SclGates( pLib, pNtk );
     p = Bus_ManStart( pNtk, pLib, pPars );
     Bus_ManReadInOutLoads( p );
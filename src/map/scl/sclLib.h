@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for timing
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -230,6 +231,7 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    Vec_Ptr_t      vCorners;       // other corners with the same cells (Vec<SC_Lib>)
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -438,6 +440,7 @@ static inline void Abc_SclCellFree( SC_Cell * p )
 }
 static inline void Abc_SclLibFree( SC_Lib * p )
 {
+    SC_Lib * pCorner;
     SC_WireLoad * pWL;
     SC_WireLoadSel * pWLS;
     SC_TableTempl * pTempl;
@@ -456,6 +459,9 @@ static inline void Abc_SclLibFree( SC_Lib * p )
         Abc_SclCellFree( pCell );
     Vec_PtrErase( &p->vCells );
     Vec_PtrErase( &p->vCellClasses );
+    Vec_PtrForEachEntry( SC_Lib *, &p->vCorners, pCorner, i )
+        Abc_SclLibFree( pCorner );
+    Vec_PtrErase( &p->vCorners );
     ABC_FREE( p->pName );
     ABC_FREE( p->pFileName );
     ABC_FREE( p->default_wire_load );
@@ -734,12 +740,14 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
+extern SC_Lib *      Abc_SclReadCache( char * pFileName, int fVerbose );
+extern void          Abc_SclWriteCache( char * pFileName, Vec_Str_t * vOut );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
@@ -748,6 +756,7 @@ extern int           Abc_SclClassCellNum( SC_Cell * pClass );
 extern void          Abc_SclShortNames( SC_Lib * p );
 extern int           Abc_SclLibClassNum( SC_Lib * pLib );
 extern void          Abc_SclLinkCells( SC_Lib * p );
+extern int           Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
@@ -26,6 +26,17 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#include <stddef.h>
+#include <sys/stat.h>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <process.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +44,28 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// The binary cache of a Liberty file is stored next to it, in the file
+// with the extension ".sclc". It contains the header identifying the Liberty
+// file followed by the SCL data, which is the same as written by "write_scl".
+// The data is mapped from the file and parsed by Abc_SclReadFromStr() in
+// the same way as the data of an SCL file, without copying it first.
+
+#define ABC_SCL_CACHE_MAGIC   "ABC_SCLC"
+#define ABC_SCL_CACHE_VERSION 1
+
+typedef struct Scl_CacheHead_t_ Scl_CacheHead_t;
+struct Scl_CacheHead_t_
+{
+    char             Magic[8];       // the file type
+    int              Version;        // the version of the cache
+    int              VersionScl;     // the version of the SCL data
+    word             SrcSize;        // the size of the Liberty file
+    word             SrcTime;        // the modification time of the Liberty file
+    word             SrcHash;        // the hash of the Liberty file
+    word             DataSize;       // the size of the SCL data
+    word             DataHash;       // the hash of the SCL data
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -630,6 +663,221 @@ void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Hashing the data of the binary cache.]
+
+  Description [Hashes 8 bytes at a time. When the data is hashed in several
+  calls, the size of all pieces except the last one should divide by 8.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Abc_SclCacheHash( unsigned char * pData, word nSize, word Hash )
+{
+    word i, Word;
+    for ( i = 0; i + 8 <= nSize; i += 8 )
+    {
+        memcpy( &Word, pData + i, 8 );
+        Hash = (Hash ^ Word) * ABC_CONST(0x9E3779B97F4A7C15);
+        Hash ^= Hash >> 29;
+    }
+    for ( ; i < nSize; i++ )
+        Hash = (Hash ^ pData[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+static int Abc_SclCacheHashFile( char * pFileName, word * pHash )
+{
+    int nBufSize = (1 << 20), nRead;
+    unsigned char * pBuffer;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( unsigned char, nBufSize );
+    *pHash = 0;
+    while ( (nRead = (int)fread( pBuffer, 1, nBufSize, pFile )) > 0 )
+        *pHash = Abc_SclCacheHash( pBuffer, (word)nRead, *pHash );
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return 1;
+}
+static int Abc_SclCacheFileStat( char * pFileName, word * pSize, word * pTime )
+{
+    struct stat Stat;
+    if ( stat( pFileName, &Stat ) != 0 )
+        return 0;
+    *pSize = (word)Stat.st_size;
+    *pTime = (word)Stat.st_mtime;
+    return 1;
+}
+static char * Abc_SclCacheFileName( char * pFileName )
+{
+    char * pCacheName = ABC_ALLOC( char, strlen(pFileName) + 10 );
+    sprintf( pCacheName, "%s.sclc", pFileName );
+    return pCacheName;
+}
+static void Abc_SclCacheUpdateTime( char * pCacheName, word SrcTime )
+{
+    // only one field is overwritten in place; a reader seeing the old
+    // time hashes the Liberty file, as before the update
+    FILE * pFile = fopen( pCacheName, "r+b" );
+    if ( pFile == NULL )
+        return;
+    if ( fseek( pFile, (long)offsetof(Scl_CacheHead_t, SrcTime), SEEK_SET ) == 0 )
+        fwrite( &SrcTime, sizeof(word), 1, pFile );
+    fclose( pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading library from the binary cache of the Liberty file.]
+
+  Description [Returns NULL if the cache does not exist or was derived
+  from another version of the Liberty file. If the modification time of
+  the Liberty file has changed, while its size is the same, the contents
+  is hashed and compared with the hash recorded in the cache. If the
+  hashes match, the new modification time is recorded in the cache, so
+  that the Liberty file is not hashed again next time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadCache( char * pFileName, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Scl_CacheHead_t Head;
+    SC_Lib * p = NULL;
+    Vec_Str_t Data;
+    char * pCacheName, * pImage;
+    word SrcSize, SrcTime, SrcHash, nImageSize;
+    struct stat Stat;
+    FILE * pFile;
+    if ( !Abc_SclCacheFileStat( pFileName, &SrcSize, &SrcTime ) )
+        return NULL;
+    pCacheName = Abc_SclCacheFileName( pFileName );
+    pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    // check the header
+    if ( fread( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) != 1 ||
+         memcmp( Head.Magic, ABC_SCL_CACHE_MAGIC, 8 ) ||
+         Head.Version != ABC_SCL_CACHE_VERSION || Head.VersionScl != ABC_SCL_CUR_VERSION ||
+         Head.SrcSize != SrcSize || Head.DataSize >= (word)0x7FFFFFFF )
+        goto finish;
+    if ( Head.SrcTime != SrcTime && (!Abc_SclCacheHashFile(pFileName, &SrcHash) || Head.SrcHash != SrcHash) )
+        goto finish;
+    // make sure the file is not truncated before mapping it
+    nImageSize = sizeof(Scl_CacheHead_t) + Head.DataSize;
+    if ( fstat( fileno(pFile), &Stat ) != 0 || (word)Stat.st_size != nImageSize )
+        goto finish;
+    // map the image
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    pImage = ABC_ALLOC( char, nImageSize );
+    rewind( pFile );
+    if ( fread( pImage, 1, (size_t)nImageSize, pFile ) != (size_t)nImageSize )
+    {
+        ABC_FREE( pImage );
+        goto finish;
+    }
+#else
+    pImage = (char *)mmap( NULL, (size_t)nImageSize, PROT_READ, MAP_PRIVATE, fileno(pFile), 0 );
+    if ( pImage == (char *)MAP_FAILED )
+        goto finish;
+#endif
+    // read the library if the data is not corrupted
+    Data.nCap   = (int)Head.DataSize;
+    Data.nSize  = (int)Head.DataSize;
+    Data.pArray = pImage + sizeof(Scl_CacheHead_t);
+    if ( Abc_SclCacheHash( (unsigned char *)Data.pArray, Head.DataSize, 0 ) == Head.DataHash )
+        p = Abc_SclReadFromStr( &Data );
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    ABC_FREE( pImage );
+#else
+    munmap( pImage, (size_t)nImageSize );
+#endif
+    if ( p == NULL )
+        goto finish;
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( p );
+    if ( Head.SrcTime != SrcTime )
+        Abc_SclCacheUpdateTime( pCacheName, SrcTime );
+    if ( fVerbose )
+    {
+        printf( "Library \"%s\" from \"%s\" has %d cells (read from cache \"%s\").  ", 
+            p->pName, pFileName, SC_LibCellNum(p), pCacheName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+finish:
+    fclose( pFile );
+    ABC_FREE( pCacheName );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writing the binary cache of the Liberty file.]
+
+  Description [The SCL data is derived from the Liberty file. The cache
+  is written into a temporary file, which is then renamed, so that other
+  processes reading the same library never see an incomplete cache.
+  Failure to write the cache is not an error.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclWriteCache( char * pFileName, Vec_Str_t * vOut )
+{
+    Scl_CacheHead_t Head;
+    char * pCacheName, * pTempName;
+    FILE * pFile;
+    int RetValue;
+    memset( &Head, 0, sizeof(Scl_CacheHead_t) );
+    memcpy( Head.Magic, ABC_SCL_CACHE_MAGIC, 8 );
+    Head.Version    = ABC_SCL_CACHE_VERSION;
+    Head.VersionScl = ABC_SCL_CUR_VERSION;
+    Head.DataSize   = (word)Vec_StrSize(vOut);
+    Head.DataHash   = Abc_SclCacheHash( (unsigned char *)Vec_StrArray(vOut), Head.DataSize, 0 );
+    if ( !Abc_SclCacheFileStat( pFileName, &Head.SrcSize, &Head.SrcTime ) )
+        return;
+    if ( !Abc_SclCacheHashFile( pFileName, &Head.SrcHash ) )
+        return;
+    pCacheName = Abc_SclCacheFileName( pFileName );
+    pTempName  = ABC_ALLOC( char, strlen(pCacheName) + 20 );
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    sprintf( pTempName, "%s.%d", pCacheName, (int)_getpid() );
+#else
+    sprintf( pTempName, "%s.%d", pCacheName, (int)getpid() );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pCacheName );
+        ABC_FREE( pTempName );
+        return;
+    }
+    RetValue  = (fwrite( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) == 1);
+    RetValue &= (fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile ) == (size_t)Vec_StrSize(vOut));
+    RetValue &= (fclose( pFile ) == 0);
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    if ( RetValue )
+        remove( pCacheName );
+#endif
+    if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+        remove( pTempName );
+    ABC_FREE( pCacheName );
+    ABC_FREE( pTempName );
+}
+
+
 /**Function*************************************************************
 
   Synopsis    [Writing library into text file.]
@@ -316,6 +316,74 @@ void Abc_SclLinkCells( SC_Lib * p )
     Vec_PtrFree( vList );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds another timing corner to the library.]
+
+  Description [The corner is a library characterized for other operating
+  conditions, which has the same cells with the same pins. The cells of
+  the corner are reordered to have the same IDs as in the library, so that
+  the gate assignment of the network is valid for both. The cells that are
+  not in the library are removed from the corner. Returns 0 and leaves
+  the corner unchanged, if some cell of the library is not in the corner.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclLibAddCorner( SC_Lib * p, SC_Lib * pCorner )
+{
+    Vec_Ptr_t * vCells;
+    SC_Cell * pCell, * pCell2;
+    int i, k, iCell;
+    // check that the cells are the same
+    SC_LibForEachCell( p, pCell, i )
+    {
+        iCell = Abc_SclCellFind( pCorner, pCell->pName );
+        if ( iCell == -1 )
+        {
+            printf( "Cell \"%s\" is not found in corner \"%s\".\n", pCell->pName, pCorner->pName );
+            return 0;
+        }
+        pCell2 = SC_LibCell( pCorner, iCell );
+        if ( pCell->n_inputs != pCell2->n_inputs || pCell->n_outputs != pCell2->n_outputs || 
+             !Vec_WrdEqual(SC_CellFunc(pCell), SC_CellFunc(pCell2)) )
+        {
+            printf( "Cell \"%s\" has different pins or function in corner \"%s\".\n", pCell->pName, pCorner->pName );
+            return 0;
+        }
+        for ( k = 0; k < pCell->n_inputs + pCell->n_outputs; k++ )
+            if ( strcmp(SC_CellPinName(pCell, k), SC_CellPinName(pCell2, k)) )
+            {
+                printf( "Cell \"%s\" has different pin order in corner \"%s\".\n", pCell->pName, pCorner->pName );
+                return 0;
+            }
+    }
+    // reorder the cells
+    vCells = Vec_PtrAlloc( SC_LibCellNum(p) );
+    SC_LibForEachCell( p, pCell, i )
+    {
+        pCell2 = SC_LibCell( pCorner, Abc_SclCellFind(pCorner, pCell->pName) );
+        pCell2->Id = i;
+        Vec_PtrPush( vCells, pCell2 );
+    }
+    SC_LibForEachCell( pCorner, pCell2, i )
+        if ( Abc_SclCellFind(p, pCell2->pName) == -1 )
+            Abc_SclCellFree( pCell2 );
+    Vec_PtrClear( &pCorner->vCells );
+    Vec_PtrAppend( &pCorner->vCells, vCells );
+    Vec_PtrFree( vCells );
+    // update the hash table and the classes
+    pCorner->nBins = 0;
+    ABC_FREE( pCorner->pBins );
+    Abc_SclHashCells( pCorner );
+    Vec_PtrClear( &pCorner->vCellClasses );
+    Abc_SclLinkCells( pCorner );
+    Vec_PtrPush( &p->vCorners, pCorner );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the largest inverter.]
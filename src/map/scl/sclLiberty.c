@@ -1677,11 +1677,13 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    if ( fUseCache && (pLib = Abc_SclReadCache( pFileName, fVerbose )) )
+        return pLib;
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
         return NULL;
@@ -1691,6 +1693,8 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
         return NULL;
+    if ( fUseCache )
+        Abc_SclWriteCache( pFileName, vStr );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
@@ -305,7 +305,7 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+static void Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept, int * pnEstNodes )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
@@ -348,7 +348,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
+        (*pnEstNodes)++;
     }
     // get the library cell
     pCell = Abc_SclObjCell( pObj );
@@ -380,6 +380,10 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         }
     }
 }
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    Abc_SclTimeNodeInt( p, pObj, fDept, &p->nEstNodes );
+}
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
     int fVerbose = 0;
@@ -407,6 +411,9 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nProcs > 1 )
+        Abc_SclTimeNtkPar( p, 0 );
+    else
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
@@ -421,11 +428,90 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( fReverse )
     {
         p->nEstNodes = 0;
+        if ( p->nProcs > 1 )
+            Abc_SclTimeNtkPar( p, 1 );
+        else
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
             Abc_SclTimeNode( p, pObj, 1 );
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Timing computation for one object in the levelized order.]
+
+  Description [These procedures are called for all objects of one level
+  at the same time, so they only modify the timing of the object itself.
+  The departure time of the object is pulled from its fanouts, which
+  gives the same result as pushing it from the fanouts in the reverse
+  topological order. The estimation counter is passed by the caller.
+  The incremental versions return 1 if the timing has changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclTimeNodeArr( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes )
+{
+    Abc_SclTimeNodeInt( p, pObj, 0, pnEstNodes );
+    return 0;
+}
+int Abc_SclTimeNodeDep( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes )
+{
+    SC_Pair Load, Dept;
+    SC_Pair * pDepIn  = Abc_SclObjDept( p, pObj );
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    Abc_Obj_t * pFanout, * pFanin;
+    float Value;
+    int i, k;
+    if ( p->EstLoadMax && Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) > 0 && Abc_SclObjLoadValue(p, pObj) > 1 )
+        (*pnEstNodes)++;
+    SC_PairClean( pDepIn );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        // use the same load and departure of the fanout as Abc_SclTimeNode()
+        Load  = *Abc_SclObjLoad( p, pFanout );
+        Dept  = *Abc_SclObjDept( p, pFanout );
+        Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = p->EstLoadAve * p->EstLoadMax;
+            Load.fall = p->EstLoadAve * p->EstLoadMax;
+            Dept.rise += EstDelta;
+            Dept.fall += EstDelta;
+        }
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclObjCell(pFanout), k), pDepIn, pSlewIn, &Load, &Dept );
+    }
+    return 0;
+}
+int Abc_SclTimeNodeArrInc( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes )
+{
+    SC_Pair ArrOut, SlewOut;
+    SC_Pair * pArrOut  = Abc_SclObjTime( p, pObj );
+    SC_Pair * pSlewOut = Abc_SclObjSlew( p, pObj );
+    float E = (float)0.1;
+    if ( Abc_ObjIsCo(pObj) ) // updated by the caller
+        return 0;
+    SC_PairMove( &ArrOut,  pArrOut  );
+    SC_PairMove( &SlewOut, pSlewOut );
+    Abc_SclTimeNodeInt( p, pObj, 0, pnEstNodes );
+    return !SC_PairEqualE(&ArrOut, pArrOut, E) || !SC_PairEqualE(&SlewOut, pSlewOut, E);
+}
+int Abc_SclTimeNodeDepInc( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes )
+{
+    SC_Pair DepOut, * pDepOut = Abc_SclObjDept( p, pObj );
+    float E = (float)0.1;
+    SC_PairMove( &DepOut, pDepOut );
+    Abc_SclDeptObj( p, pObj );
+    return !SC_PairEqualE(&DepOut, pDepOut, E);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Incremental timing update.]
@@ -477,6 +563,48 @@ static inline void Abc_SclTimeIncAddFanouts( SC_Man * p, Abc_Obj_t * pObj )
         if ( !pFanout->fMarkC && !Abc_ObjIsLatch(pFanout) )
             Abc_SclTimeIncAddNode( p, pFanout );
 }
+static inline void Abc_SclTimeIncUpdateArrivalPar( SC_Man * p )
+{
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj;
+    char * pFlags;
+    int i, k, nDone;
+    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+    {
+        // compute the level, then schedule the fanouts in the same order as below
+        nDone  = Vec_IntSize(vLevel);
+        pFlags = Abc_SclTimeParLevel( p, vLevel, Abc_SclTimeNodeArrInc );
+        Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
+        {
+            if ( Abc_ObjIsCo(pObj) )
+            {
+                Abc_SclObjDupFanin( p, pObj );
+                Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+                Vec_QueUpdate( p->vQue, pObj->iData );
+                continue;
+            }
+            if ( k < nDone ? pFlags[k] : Abc_SclTimeNodeArrInc(p, pObj, &p->nEstNodes) )
+                Abc_SclTimeIncAddFanouts( p, pObj );
+        }
+    }
+    p->MaxDelay = Abc_SclReadMaxDelay( p );
+}
+static inline void Abc_SclTimeIncUpdateDeparturePar( SC_Man * p )
+{
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj;
+    char * pFlags;
+    int i, k, nDone;
+    Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
+    {
+        nDone  = Vec_IntSize(vLevel);
+        pFlags = Abc_SclTimeParLevel( p, vLevel, Abc_SclTimeNodeDepInc );
+        Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
+            if ( k < nDone ? pFlags[k] : Abc_SclTimeNodeDepInc(p, pObj, &p->nEstNodes) )
+                Abc_SclTimeIncAddFanins( p, pObj );
+    } 
+    p->MaxDelay = Abc_SclReadMaxDelay( p );
+}
 static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
 {
     Vec_Int_t * vLevel;
@@ -485,6 +613,11 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
     Abc_Obj_t * pObj;
     float E = (float)0.1;
     int i, k;
+    if ( p->nProcs > 1 )
+    {
+        Abc_SclTimeIncUpdateArrivalPar( p );
+        return;
+    }
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
         Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
@@ -515,6 +648,11 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
     Abc_Obj_t * pObj;
     float E = (float)0.1;
     int i, k;
+    if ( p->nProcs > 1 )
+    {
+        Abc_SclTimeIncUpdateDeparturePar( p );
+        return;
+    }
     Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
     {
         Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
@@ -657,6 +795,189 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Timing managers for the other corners of the library.]
+
+  Description [The corners share the gate assignment of the network with
+  the main manager. Since the cells of the corners have the same IDs as 
+  the cells of the library, switching to another corner only changes the 
+  library of the network (pNtk->pSCLib), which is used to get the cells.
+  The network is left with the library of the main manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclManStartCorners( SC_Man * p, int fUseWireLoads, int fDept, float DUser )
+{
+    SC_Lib * pCorner;
+    SC_Man * pCor;
+    int i;
+    assert( p->vCorners == NULL );
+    assert( p->pNtk->pSCLib == p->pLib );
+    p->vCorners = Vec_PtrAlloc( Vec_PtrSize(&p->pLib->vCorners) );
+    p->vGatesCor = Vec_IntDup( p->pNtk->vGates );
+    Vec_PtrForEachEntry( SC_Lib *, &p->pLib->vCorners, pCorner, i )
+    {
+        pCor = Abc_SclManAlloc( pCorner, p->pNtk );
+        pCor->EstLoadMax = p->EstLoadMax;
+        pCor->EstLinear  = p->EstLinear;
+        pCor->nProcs     = p->nProcs;
+        Abc_SclManReadSlewAndLoad( pCor, p->pNtk );
+        if ( fUseWireLoads )
+            pCor->pWLoadUsed = Abc_SclFindWireLoadModel( pCorner, Abc_SclGetTotalArea(p->pNtk) );
+        p->pNtk->pSCLib = pCorner;
+        Abc_SclTimeNtkRecompute( pCor, &pCor->SumArea0, &pCor->MaxDelay0, fDept, DUser );
+        pCor->SumArea  = pCor->SumArea0;
+        pCor->MaxDelay = pCor->MaxDelay0;
+        Vec_PtrPush( p->vCorners, pCor );
+    }
+    p->pNtk->pSCLib = p->pLib;
+}
+SC_Man * Abc_SclManWorstCorner( SC_Man * p )
+{
+    SC_Man * pCor, * pWorst = p;
+    int i;
+    Vec_PtrForEachEntry( SC_Man *, p->vCorners, pCor, i )
+        if ( pWorst->MaxDelay < pCor->MaxDelay )
+            pWorst = pCor;
+    return pWorst;
+}
+static void Abc_SclManTimeCornerInc( SC_Man * pCor, Vec_Int_t * vNodes, int fDept )
+{
+    if ( fDept )
+        Abc_SclTimeIncUpdate( pCor );
+    else if ( Vec_IntSize(vNodes) > 0 )
+    {
+        Vec_Int_t * vTFO = Abc_SclFindTFO( pCor->pNtk, vNodes );
+        Abc_SclTimeCone( pCor, vTFO );
+        Vec_IntFree( vTFO );
+    }
+    pCor->MaxDelay = Abc_SclReadMaxDelay( pCor );
+}
+SC_Man * Abc_SclManTimeCorners( SC_Man * p, SC_Man * pSkip, Vec_Int_t * vUpdates, int fDept, float DUser )
+{
+    Vec_Int_t * vNodes;
+    SC_Man * pCor;
+    SC_Cell * pCellOld, * pCellNew;
+    Abc_Obj_t * pObj;
+    int i, k, iObj, iCellOld, iCellNew;
+    if ( vUpdates == NULL )
+    {
+        // recompute timing of all managers, except the one that is up to date
+        if ( p != pSkip )
+        {
+            p->pNtk->pSCLib = p->pLib;
+            Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, fDept, DUser );
+        }
+        Vec_PtrForEachEntry( SC_Man *, p->vCorners, pCor, i )
+        {
+            if ( pCor == pSkip )
+                continue;
+            p->pNtk->pSCLib = pCor->pLib;
+            Abc_SclTimeNtkRecompute( pCor, &pCor->SumArea, &pCor->MaxDelay, fDept, DUser );
+        }
+        Vec_IntClear( p->vGatesCor );
+        Vec_IntAppend( p->vGatesCor, p->pNtk->vGates );
+        p->pNtk->pSCLib = p->pLib;
+        return Abc_SclManWorstCorner( p );
+    }
+    // update the loads of the other managers for the gates changed since they were timed
+    vNodes = Vec_IntAlloc( Vec_IntSize(vUpdates) / 2 );
+    for ( i = 0; i + 1 < Vec_IntSize(vUpdates); i += 2 )
+    {
+        iObj     = Vec_IntEntry( vUpdates, i );
+        pObj     = Abc_NtkObj( p->pNtk, iObj );
+        iCellOld = Vec_IntEntry( p->vGatesCor, iObj );
+        iCellNew = Vec_IntEntry( p->pNtk->vGates, iObj );
+        if ( iCellOld == iCellNew )
+            continue;
+        for ( k = -1; k < Vec_PtrSize(p->vCorners); k++ )
+        {
+            pCor = k == -1 ? p : (SC_Man *)Vec_PtrEntry( p->vCorners, k );
+            if ( pCor == pSkip )
+                continue;
+            pCellOld = SC_LibCell( pCor->pLib, iCellOld );
+            pCellNew = SC_LibCell( pCor->pLib, iCellNew );
+            Abc_SclUpdateLoad( pCor, pObj, pCellOld, pCellNew );
+            if ( fDept )
+                Abc_SclTimeIncInsert( pCor, pObj );
+        }
+        Vec_IntWriteEntry( p->vGatesCor, iObj, iCellNew );
+        Vec_IntPush( vNodes, iObj );
+    }
+    // update timing of the cones of the changed gates
+    if ( p != pSkip )
+    {
+        p->pNtk->pSCLib = p->pLib;
+        Abc_SclManTimeCornerInc( p, vNodes, fDept );
+    }
+    Vec_PtrForEachEntry( SC_Man *, p->vCorners, pCor, i )
+    {
+        if ( pCor == pSkip )
+            continue;
+        p->pNtk->pSCLib = pCor->pLib;
+        Abc_SclManTimeCornerInc( pCor, vNodes, fDept );
+    }
+    Vec_IntFree( vNodes );
+    p->pNtk->pSCLib = p->pLib;
+    return Abc_SclManWorstCorner( p );
+}
+void Abc_SclManStopCorners( SC_Man * p )
+{
+    Vec_Int_t * vGates = p->pNtk->vGates;
+    Abc_Obj_t * pObj;
+    SC_Man * pCor;
+    int i;
+    if ( p->vCorners == NULL )
+        return;
+    // the gates of the network are freed by the main manager
+    Vec_PtrForEachEntry( SC_Man *, p->vCorners, pCor, i )
+    {
+        p->pNtk->vGates = NULL;
+        Abc_SclTimeParStop( pCor );
+        Abc_SclManFree( pCor );
+    }
+    Vec_PtrFreeP( &p->vCorners );
+    Vec_IntFreeP( &p->vGatesCor );
+    p->pNtk->vGates = vGates;
+    p->pNtk->pSCLib = p->pLib;
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        pObj->iData = i;
+    Abc_NtkForEachCo( p->pNtk, pObj, i )
+        pObj->iData = i;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the corner of the library with the largest delay.]
+
+  Description [Returns the library itself if it has no other corners.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclFindWorstCorner( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fVerbose )
+{
+    SC_Man * p, * pWorst;
+    SC_Lib * pWorstLib;
+    if ( Vec_PtrSize(&pLib->vCorners) == 0 )
+        return pLib;
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 0, 0, 0 );
+    Abc_SclManStartCorners( p, fUseWireLoads, 0, 0 );
+    pWorst = Abc_SclManWorstCorner( p );
+    pWorstLib = pWorst->pLib;
+    if ( fVerbose )
+        printf( "The worst corner is \"%s\" with delay %.2f ps.\n", pWorstLib->pName, pWorst->MaxDelay );
+    Abc_SclManStopCorners( p );
+    Abc_SclManFree( p );
+    return pWorstLib;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Printing out timing information for the network.]
@@ -675,6 +996,18 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
+    if ( Vec_PtrSize(&pLib->vCorners) > 0 )
+    {
+        SC_Man * pCor, * pWorst;
+        int i;
+        Abc_SclManStartCorners( p, fUseWireLoads, 1, 0 );
+        pWorst = Abc_SclManWorstCorner( p );
+        printf( "Corner %2d : %-24s  Delay =%9.2f ps\n", 0, pLib->pName, p->MaxDelay );
+        Vec_PtrForEachEntry( SC_Man *, p->vCorners, pCor, i )
+            printf( "Corner %2d : %-24s  Delay =%9.2f ps\n", i+1, pCor->pLib->pName, pCor->MaxDelay );
+        printf( "The worst corner is \"%s\".\n", pWorst->pLib->pName );
+        Abc_SclManStopCorners( p );
+    }
     Abc_SclManFree( p );
 }
 
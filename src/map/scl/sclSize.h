@@ -42,6 +42,7 @@ ABC_NAMESPACE_HEADER_START
 ////////////////////////////////////////////////////////////////////////
 
 typedef struct SC_Man_          SC_Man;
+typedef int (*Scl_TimeFunc_t)( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes );
 struct SC_Man_ 
 {
     SC_Lib *       pLib;          // library
@@ -82,6 +83,13 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // levelized parallel timing
+    int            nProcs;        // the number of threads
+    void *         pTimePar;      // the threads computing timing
+    Vec_Str_t *    vTimeFlags;    // the change flags of objects in one level
+    // multi-corner timing
+    Vec_Ptr_t *    vCorners;      // timing managers of the other corners of the library
+    Vec_Int_t *    vGatesCor;     // gates used when the corners were last timed
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -215,6 +223,9 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_IntFreeP( &p->vGatesBest );
     Vec_WecFreeP( &p->vLevels );
     Vec_IntFreeP( &p->vChanged );
+    Vec_StrFreeP( &p->vTimeFlags );
+    assert( p->pTimePar == NULL );
+    assert( p->vCorners == NULL );
 //    Vec_QuePrint( p->vQue );
     Vec_QueCheck( p->vQue );
     Vec_QueFreeP( &p->vQue );
@@ -566,12 +577,26 @@ extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPa
 extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
+extern int           Abc_SclTimeNodeArr( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes );
+extern int           Abc_SclTimeNodeDep( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes );
+extern int           Abc_SclTimeNodeArrInc( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes );
+extern int           Abc_SclTimeNodeDepInc( SC_Man * p, Abc_Obj_t * pObj, int * pnEstNodes );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
+extern void          Abc_SclManStartCorners( SC_Man * p, int fUseWireLoads, int fDept, float DUser );
+extern SC_Man *      Abc_SclManWorstCorner( SC_Man * p );
+extern SC_Man *      Abc_SclManTimeCorners( SC_Man * p, SC_Man * pSkip, Vec_Int_t * vUpdates, int fDept, float DUser );
+extern void          Abc_SclManStopCorners( SC_Man * p );
+extern SC_Lib *      Abc_SclFindWorstCorner( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fVerbose );
 extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
+/*=== sclTimePth.c ===============================================================*/
+extern char *        Abc_SclTimeParLevel( SC_Man * p, Vec_Int_t * vObjs, Scl_TimeFunc_t Func );
+extern void          Abc_SclTimeNtkPar( SC_Man * p, int fDept );
+extern void          Abc_SclTimeParStop( SC_Man * p );
 /*=== sclUpsize.c ===============================================================*/
+extern Vec_Int_t *   Abc_SclFindTFO( Abc_Ntk_t * p, Vec_Int_t * vPath );
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
 /*=== sclUtil.c ===============================================================*/
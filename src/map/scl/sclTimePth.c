@@ -0,0 +1,323 @@
+/**CFile****************************************************************
+
+  FileName    [sclTimePth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Levelized timing analysis using concurrent threads.]
+
+  Author      [Alan Mishchenko, Niklas Een]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sclTimePth.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "misc/vec/vecWec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Objects of one level depend only on the objects of the lower (arrival)
+// or higher (departure) levels, so they are timed by several threads at
+// the same time. The changes are reported through the flags, one per
+// object, which are read by the caller after the level is done. Updates
+// of the shared data (output queue, fanout scheduling) remain sequential.
+// Between the levels, the threads wait on a condition variable.
+
+#define SCL_THR_MAX   100
+#define SCL_PAR_MIN    64     // the smallest level timed by the threads
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Times one range of objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclTimeParRange( SC_Man * p, Vec_Int_t * vObjs, Scl_TimeFunc_t Func, char * pFlags, int iStart, int iStop, int * pnEstNodes )
+{
+    int i;
+    for ( i = iStart; i < iStop; i++ )
+        pFlags[i] = (char)Func( p, Abc_NtkObj(p->pNtk, Vec_IntEntry(vObjs, i)), pnEstNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Times the internal nodes level by level.]
+
+  Description [Computes arrival times (fDept = 0) or departure times
+  (fDept = 1) of the internal nodes. The CIs and COs are timed by the
+  caller. The result is the same as that of the sequential traversal
+  of the nodes in the topological order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeNtkPar( SC_Man * p, int fDept )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel, * vObjLevs;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level;
+    // levelize the nodes assuming the topological order of IDs
+    vObjLevs = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    vLevels  = Vec_WecAlloc( 100 );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vObjLevs, Abc_ObjId(pFanin)) );
+        Vec_IntWriteEntry( vObjLevs, i, ++Level );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vObjLevs );
+    if ( fDept )
+    {
+        // departure times of the CIs and constants are also derived from their fanouts
+        Abc_NtkForEachCi( p->pNtk, pObj, i )
+            Vec_WecPush( vLevels, 0, Abc_ObjId(pObj) );
+        Abc_NtkForEachNode( p->pNtk, pObj, i )
+            if ( Abc_ObjFaninNum(pObj) == 0 )
+                Vec_WecPush( vLevels, 0, i );
+        Vec_WecForEachLevelReverse( vLevels, vLevel, i )
+            Abc_SclTimeParLevel( p, vLevel, Abc_SclTimeNodeDep );
+    }
+    else
+    {
+        Vec_WecForEachLevelStart( vLevels, vLevel, i, 1 )
+            Abc_SclTimeParLevel( p, vLevel, Abc_SclTimeNodeArr );
+    }
+    Vec_WecFree( vLevels );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+char * Abc_SclTimeParLevel( SC_Man * p, Vec_Int_t * vObjs, Scl_TimeFunc_t Func )
+{
+    if ( p->vTimeFlags == NULL )
+        p->vTimeFlags = Vec_StrAlloc( 1000 );
+    Vec_StrFill( p->vTimeFlags, Vec_IntSize(vObjs), 0 );
+    Abc_SclTimeParRange( p, vObjs, Func, Vec_StrArray(p->vTimeFlags), 0, Vec_IntSize(vObjs), &p->nEstNodes );
+    return Vec_StrArray(p->vTimeFlags);
+}
+void Abc_SclTimeParStop( SC_Man * p ) {}
+
+#else // pthreads are used
+
+typedef struct Scl_TimePar_t_ Scl_TimePar_t;
+
+typedef struct Scl_ThData_t_ Scl_ThData_t;
+struct Scl_ThData_t_
+{
+    Scl_TimePar_t *  pPar;           // thread manager
+    int              iStart;         // the first object of this thread
+    int              iStop;          // the last object of this thread
+    int              nEstNodes;      // the number of estimations
+};
+
+struct Scl_TimePar_t_
+{
+    SC_Man *         p;              // sizing manager
+    int              nProcs;         // the number of threads, including this one
+    Vec_Int_t *      vObjs;          // objects of the current level
+    Scl_TimeFunc_t   Func;           // procedure to time one object
+    char *           pFlags;         // change flags of the objects
+    int              iRound;         // the number of levels given to the threads
+    int              nBusy;          // the number of threads timing the current level
+    int              fStop;          // the threads should exit
+    pthread_mutex_t  Mutex;          // protects the fields above
+    pthread_cond_t   CondStart;      // signals a new level or the stop
+    pthread_cond_t   CondDone;       // signals that the last thread is done
+    Scl_ThData_t     ThData[SCL_THR_MAX];
+    pthread_t        WorkerThread[SCL_THR_MAX];
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread timing its range of the current level.]
+
+  Description [The thread sleeps on the condition variable between the
+  levels, so it does not use the CPU while the caller is busy with the
+  sequential parts of sizing.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_SclTimeWorkerThread( void * pArg )
+{
+    Scl_ThData_t * pThData = (Scl_ThData_t *)pArg;
+    Scl_TimePar_t * pPar = pThData->pPar;
+    int iRound = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( pPar->iRound == iRound && !pPar->fStop )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        iRound = pPar->iRound;
+        pthread_mutex_unlock( &pPar->Mutex );
+        if ( pPar->fStop )
+            return NULL;
+        Abc_SclTimeParRange( pPar->p, pPar->vObjs, pPar->Func, pPar->pFlags, pThData->iStart, pThData->iStop, &pThData->nEstNodes );
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the threads.]
+
+  Description [The threads are kept while the manager is used because
+  incremental updates time many small levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Scl_TimePar_t * Abc_SclTimeParStart( SC_Man * p )
+{
+    Scl_TimePar_t * pPar = ABC_CALLOC( Scl_TimePar_t, 1 );
+    int i, status;
+    pPar->p      = p;
+    pPar->nProcs = Abc_MinInt( p->nProcs, SCL_THR_MAX );
+    status = pthread_mutex_init( &pPar->Mutex, NULL );        assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondStart, NULL );     assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondDone, NULL );      assert( status == 0 );
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        pPar->ThData[i].pPar = pPar;
+        status = pthread_create( pPar->WorkerThread + i, NULL, Abc_SclTimeWorkerThread, (void *)(pPar->ThData + i) );  assert( status == 0 );
+    }
+    return pPar;
+}
+void Abc_SclTimeParStop( SC_Man * p )
+{
+    Scl_TimePar_t * pPar = (Scl_TimePar_t *)p->pTimePar;
+    int i, status;
+    if ( pPar == NULL )
+        return;
+    pthread_mutex_lock( &pPar->Mutex );
+    assert( pPar->nBusy == 0 );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        status = pthread_join( pPar->WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    ABC_FREE( pPar );
+    p->pTimePar = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Times the objects of one level.]
+
+  Description [Calls Func for each object, splitting the objects among
+  the threads. Returns the array of the values returned by Func, which
+  is valid until the next call. Small levels are timed by this thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_SclTimeParLevel( SC_Man * p, Vec_Int_t * vObjs, Scl_TimeFunc_t Func )
+{
+    Scl_TimePar_t * pPar;
+    char * pFlags;
+    int i, nObjs = Vec_IntSize(vObjs), nProcs, nChunk;
+    if ( p->vTimeFlags == NULL )
+        p->vTimeFlags = Vec_StrAlloc( 1000 );
+    Vec_StrFill( p->vTimeFlags, nObjs, 0 );
+    pFlags = Vec_StrArray( p->vTimeFlags );
+    if ( p->nProcs < 2 || nObjs < SCL_PAR_MIN )
+    {
+        Abc_SclTimeParRange( p, vObjs, Func, pFlags, 0, nObjs, &p->nEstNodes );
+        return pFlags;
+    }
+    if ( p->pTimePar == NULL )
+        p->pTimePar = Abc_SclTimeParStart( p );
+    pPar   = (Scl_TimePar_t *)p->pTimePar;
+    nProcs = Abc_MinInt( pPar->nProcs, nObjs / (SCL_PAR_MIN / 2) );
+    nChunk = (nObjs + nProcs - 1) / nProcs;
+    // give the ranges to the threads (the extra threads get empty ranges)
+    pthread_mutex_lock( &pPar->Mutex );
+    assert( pPar->nBusy == 0 );
+    pPar->vObjs  = vObjs;
+    pPar->Func   = Func;
+    pPar->pFlags = pFlags;
+    for ( i = 1; i < pPar->nProcs; i++ )
+    {
+        Scl_ThData_t * pThData = pPar->ThData + i;
+        pThData->iStart    = Abc_MinInt( i * nChunk, nObjs );
+        pThData->iStop     = i < nProcs ? Abc_MinInt( (i + 1) * nChunk, nObjs ) : pThData->iStart;
+        pThData->nEstNodes = 0;
+    }
+    pPar->nBusy = pPar->nProcs - 1;
+    pPar->iRound++;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    // time the first range here
+    Abc_SclTimeParRange( p, vObjs, Func, pFlags, 0, Abc_MinInt(nChunk, nObjs), &p->nEstNodes );
+    // wait till the threads finish
+    pthread_mutex_lock( &pPar->Mutex );
+    while ( pPar->nBusy > 0 )
+        pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( i = 1; i < pPar->nProcs; i++ )
+        p->nEstNodes += pPar->ThData[i].nEstNodes;
+    return pFlags;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
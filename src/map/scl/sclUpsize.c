@@ -867,7 +867,7 @@ void Abc_SclUpsizeRemoveDangling( SC_Man * p, Abc_Ntk_t * pNtk )
 ***********************************************************************/
 void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars )
 {
-    SC_Man * p;
+    SC_Man * p, * pT;               // the manager and the manager of the worst corner
     Vec_Int_t * vPathPos = NULL;    // critical POs
     Vec_Int_t * vPathNodes = NULL;  // critical nodes and PIs
     abctime clk, nRuntimeLimit = pPars->TimeOut ? pPars->TimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
@@ -884,6 +884,8 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         printf( "Target =%5d ps. ",       pPars->DelayUser );
         printf( "DelayGap =%3d ps. ",     pPars->DelayGap );
         printf( "Timeout =%4d sec",       pPars->TimeOut  );
+        if ( pPars->nProcs > 1 )
+        printf( ".  Threads =%3d",        pPars->nProcs   );
         printf( "\n" );
     }
     // increase window for larger networks
@@ -891,10 +893,25 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
     p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p->nProcs     = pPars->nProcs;
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
     p->BestDelay  = p->MaxDelay0;
+    pT = p;
+    // time the other corners and size for the worst one
+    if ( Vec_PtrSize(&pLib->vCorners) > 0 )
+    {
+        if ( pPars->BypassFreq )
+            printf( "Bypassing is not supported when sizing for several corners and is disabled.\n" );
+        pPars->BypassFreq = 0;
+        Abc_SclManStartCorners( p, pPars->fUseWireLoads, pPars->fUseDept, 0 );
+        pT = Abc_SclManWorstCorner( p );
+        pNtk->pSCLib  = pT->pLib;
+        p->MaxDelay0  = p->MaxDelay = p->BestDelay = pT->MaxDelay;
+        if ( pPars->fVerbose )
+            printf( "Sizing for %d corners. The worst corner is \"%s\".\n", Vec_PtrSize(p->vCorners) + 1, pT->pLib->pName );
+    }
     // perform upsizing
     nAllPos = nAllNodes = nAllTfos = nAllUpsizes = 0;
     if ( p->BestDelay <= pPars->DelayUser )
@@ -906,8 +923,8 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         {
             // detect critical path
             clk = Abc_Clock();
-            vPathPos   = Abc_SclFindCriticalCoWindow( p, win );
-            vPathNodes = Abc_SclFindCriticalNodeWindow( p, vPathPos, win, pPars->fUseDept );
+            vPathPos   = Abc_SclFindCriticalCoWindow( pT, win );
+            vPathNodes = Abc_SclFindCriticalNodeWindow( pT, vPathPos, win, pPars->fUseDept );
             p->timeCone += Abc_Clock() - clk;
 
             // selectively upsize the nodes
@@ -915,13 +932,13 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( pT, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
             clk = Abc_Clock();
-            Abc_SclUnmarkCriticalNodeWindow( p, vPathNodes );
-            Abc_SclUnmarkCriticalNodeWindow( p, vPathPos );
+            Abc_SclUnmarkCriticalNodeWindow( pT, vPathNodes );
+            Abc_SclUnmarkCriticalNodeWindow( pT, vPathPos );
             p->timeCone += Abc_Clock() - clk;
             if ( nUpsizes > 0 )
                 break;
@@ -935,24 +952,42 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         clk = Abc_Clock();
         if ( pPars->fUseDept )
         {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
+            if ( Vec_IntSize(pT->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
+                nConeSize = Abc_SclTimeIncUpdate( pT );
             else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
+                Abc_SclTimeNtkRecompute( pT, NULL, NULL, pPars->fUseDept, 0 );
         }
         else
         {
             Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
+            Abc_SclTimeCone( pT, vTFO );
             nConeSize = Vec_IntSize( vTFO );
             Vec_IntFree( vTFO );
         }
+        pT->MaxDelay = Abc_SclReadMaxDelay( pT );
+        // retime the other corners and switch to the worst one;
+        // the main manager reports the area and the worst delay
+        if ( p->vCorners )
+        {
+            SC_Man * pPrev = pT;
+            pT = Abc_SclManTimeCorners( p, pPrev, pPrev->vUpdates, pPars->fUseDept, 0 );
+            Vec_IntClear( pPrev->vUpdates );
+            p->SumArea   = Abc_SclGetTotalArea( pNtk );
+            p->MaxDelay  = pT->MaxDelay;
+            pNtk->pSCLib = pT->pLib;
+        }
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
         // save the best network
-        p->MaxDelay = Abc_SclReadMaxDelay( p );
-        if ( p->BestDelay > p->MaxDelay )
+        if ( p->BestDelay > p->MaxDelay && p->vCorners )
+        {
+            p->BestDelay = p->MaxDelay;
+            Vec_IntClear( p->vGatesBest );
+            Vec_IntAppend( p->vGatesBest, p->pNtk->vGates );
+            nFramesNoChange = 0;
+        }
+        else if ( p->BestDelay > p->MaxDelay )
         {
             p->BestDelay = p->MaxDelay;
             Abc_SclApplyUpdateToBest( p->vGatesBest, p->pNtk->vGates, p->vUpdates );
@@ -986,7 +1021,10 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         Abc_SclUndoRecentChanges( p->pNtk, p->vUpdates2 );
     if ( pPars->BypassFreq != 0 )
         Abc_SclUpsizeRemoveDangling( p, pNtk );
+    pNtk->pSCLib = pLib;
     Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, 0, 0 );
+    if ( p->vCorners )
+        p->MaxDelay = Abc_SclManTimeCorners( p, p, NULL, 0, 0 )->MaxDelay;
     if ( pPars->fVerbose )
         Abc_SclUpsizePrint( p, i, pPars->Window, nAllPos/(i?i:1), nAllNodes/(i?i:1), nAllUpsizes/(i?i:1), nAllTfos/(i?i:1), 1 );
     else
@@ -1008,7 +1046,9 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
         printf( "Gate sizing timed out at %d seconds.\n", pPars->TimeOut );
 
     // save the result and quit
+    Abc_SclManStopCorners( p );
     Abc_SclSclGates2MioGates( pLib, pNtk ); // updates gate pointers
+    Abc_SclTimeParStop( p );
     Abc_SclManFree( p );
 //    Abc_NtkCleanMarkAB( pNtk );
 }
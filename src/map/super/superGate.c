@@ -19,6 +19,17 @@
 #include <math.h>
 #include "superInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -48,6 +59,8 @@ struct Super_ManStruct_t_
     float               tAreaMax;     // the max area of the supergates in the library
     int                 fSkipInv;     // the flag says about skipping inverters
     int                 fWriteOldFormat; // in addition, writes the file in the old format
+    int                 nProcs;       // the number of threads
+    int                 fKeepRemoved; // the removed gates are not recycled
     int                 fVerbose;
 
     // supergates
@@ -106,6 +119,7 @@ static void           Super_ManStop( Super_Man_t * pMan );
 static void           Super_AddGateToTable( Super_Man_t * pMan, Super_Gate_t * pGate );
 static void           Super_First( Super_Man_t * pMan, int nVarsMax );
 static Super_Man_t *  Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv );
+static Super_Man_t *  Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv );
 static Super_Gate_t * Super_CreateGateNew( Super_Man_t * pMan, Mio_Gate_t * pRoot, Super_Gate_t ** pSupers, int nSupers, unsigned uTruth[], float Area, float tPinDelaysRes[], float tDelayMax, int nPins );
 static int            Super_CompareGates( Super_Man_t * pMan, unsigned uTruth[], float Area, float tPinDelaysRes[], int nPins );
 static int            Super_DelayCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
@@ -137,7 +151,7 @@ static Vec_Str_t *    Super_WriteLibraryTreeStr( Super_Man_t * pMan );
   SeeAlso     []
 
 ***********************************************************************/
-void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose, char * pFileName )
+void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose, char * pFileName )
 {
     Vec_Str_t * vStr;
     FILE * pFile = fopen( pFileName, "wb" );
@@ -146,7 +160,12 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
         printf( "Cannot open output file \"%s\".\n", pFileName );
         return;
     }
-    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, fVerbose );
+    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose );
+    if ( vStr == NULL )
+    {
+        fclose( pFile );
+        return;
+    }
     fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
     fclose( pFile );
     Vec_StrFree( vStr );
@@ -169,7 +188,7 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose )
+Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose )
 {
     Vec_Str_t * vStr;
     Super_Man_t * pMan;
@@ -202,6 +221,7 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
     pMan->tAreaMax  = tAreaMax;
     pMan->TimeLimit = TimeLimit; // in seconds
     pMan->TimeStop  = TimeLimit ? TimeLimit * CLOCKS_PER_SEC + Abc_Clock() : 0; // in CPU ticks
+    pMan->nProcs    = nProcs;
     pMan->fVerbose  = fVerbose;
 
     if ( nGates == 0 )
@@ -228,6 +248,8 @@ if ( fVerbose )
         pMan->nVarsMax, nLevels, nGatesMax );
     printf( "Limits: max delay =  %.2f, max area =  %.2f, time limit = %d sec.\n", 
         pMan->tDelayMax, pMan->tAreaMax, pMan->TimeLimit );
+    if ( pMan->nProcs > 1 )
+    printf( "Using %d threads.\n", pMan->nProcs );
 }
 
     for ( Level = 1; Level <= nLevels; Level++ )
@@ -235,7 +257,10 @@ if ( fVerbose )
         if ( pMan->TimeStop && Abc_Clock() > pMan->TimeStop )
             break;
 clk = Abc_Clock();
-        Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+        if ( pMan->nProcs > 1 )
+            Super_ComputePar( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+        else
+            Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
         pMan->nLevels = Level;
 if ( fVerbose )
 {
@@ -324,6 +349,98 @@ void Super_First( Super_Man_t * pMan, int nVarsMax )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the array of supergates to compose other gates.]
+
+  Description [The gates from the unique table are put into the array 
+  sorted in the increasing order of maximum delay. The gates from the 
+  array will be used to compose other gates, while the gates in the table 
+  are used to check uniqueness of collected gates.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Super_PrepareArray( Super_Man_t * pMan )
+{
+    Super_TranferGatesToArray( pMan );
+    // sort the gates in the increasing order of maximum delay
+    if ( pMan->nGates > 10000 )
+    {
+        printf( "Sorting array of %d supergates...\r", pMan->nGates );
+        fflush( stdout );
+    }
+    qsort( (void *)pMan->pGates, (size_t)pMan->nGates, sizeof(Super_Gate_t *), 
+            (int (*)(const void *, const void *)) Super_DelayCompare );
+    assert( Super_DelayCompare( pMan->pGates, pMan->pGates + pMan->nGates - 1 ) <= 0 );
+    if ( pMan->nGates > 10000 )
+    {
+        printf( "                                       \r" );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the gates to be considered with the given root gate.]
+
+  Description [Returns the number of selected gates sorted by area, 
+  or -1 if the root gate is skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Super_CollectLimit( Super_Man_t * pMan, Mio_Gate_t * pRoot, Super_Gate_t ** ppGatesLimit )
+{
+    float tDelayMio;
+    int nGatesLimit, s, t;
+    int fPrune = 1;                     // Shall we prune?
+    int iPruneLimit = 3;                // Each of the gates plugged into the root gate will have 
+                                        // less than these many fanins
+    int iPruneLimitRoot = 4;            // The root gate may have only less than these many fanins
+    if ( fPrune )
+    {
+        if ( pMan->nLevels >= 1 )  // First level gates have been computed
+        {
+            if ( Mio_GateReadPinNum(pRoot) >= iPruneLimitRoot )
+                return -1;
+        }
+    }
+    // select the subset of gates to be considered with this root gate
+    // all the gates past this point will lead to delay larger than the limit
+    tDelayMio = (float)Mio_GateReadDelayMax(pRoot);
+    for ( s = 0, t = 0; s < pMan->nGates; s++ )
+    {
+        if ( fPrune && ( pMan->nLevels >= 1 ) && ( ((int)pMan->pGates[s]->nFanins) >= iPruneLimit ))
+            continue;
+        
+        ppGatesLimit[t] = pMan->pGates[s];
+        if ( ppGatesLimit[t++]->tDelayMax + tDelayMio > pMan->tDelayMax && pMan->tDelayMax > 0.0 )
+            break;
+    }
+    nGatesLimit = t;
+
+    if ( pMan->fVerbose )
+    {
+        printf ("Trying %d choices for %d inputs\r", t, Mio_GateReadPinNum(pRoot) );
+    }
+
+    // resort part of this range by area
+    // now we can prune the search by going up in the list until we reach the limit on area
+    // all the gates beyond this point can be skipped because their area can be only larger
+    if ( nGatesLimit > 10000 )
+        printf( "Sorting array of %d supergates...\r", nGatesLimit );
+    qsort( (void *)ppGatesLimit, (size_t)nGatesLimit, sizeof(Super_Gate_t *), 
+            (int (*)(const void *, const void *)) Super_AreaCompare );
+    assert( Super_AreaCompare( ppGatesLimit, ppGatesLimit + nGatesLimit - 1 ) <= 0 );
+    if ( nGatesLimit > 10000 )
+        printf( "                                       \r" );
+    return nGatesLimit;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Precomputes one level of supergates.]
@@ -343,38 +460,18 @@ void Super_First( Super_Man_t * pMan, int nVarsMax )
 Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv )
 {
     Super_Gate_t * pSupers[6], * pGate0, * pGate1, * pGate2, * pGate3, * pGate4, * pGate5, * pGateNew;
-    float tPinDelaysRes[6], * ptPinDelays[6], tPinDelayMax, tDelayMio;
+    float tPinDelaysRes[6], * ptPinDelays[6], tPinDelayMax;
     float Area = 0.0; // Suppress "might be used uninitialized"
     float Area0, Area1, Area2, Area3, Area4, AreaMio;
     unsigned uTruth[2], uTruths[6][2];
     int i0, i1, i2, i3, i4, i5; 
     Super_Gate_t ** ppGatesLimit;
-    int nFanins, nGatesLimit, k, s, t;
+    int nFanins, nGatesLimit, k;
     ProgressBar * pProgress;
     int fTimeOut;
-    int fPrune = 1;                     // Shall we prune?
-    int iPruneLimit = 3;                // Each of the gates plugged into the root gate will have 
-                                        // less than these many fanins
-    int iPruneLimitRoot = 4;            // The root gate may have only less than these many fanins
 
     // put the gates from the unique table into the array
-    // the gates from the array will be used to compose other gates
-    // the gates in tbe table are used to check uniqueness of collected gates
-    Super_TranferGatesToArray( pMan );
-
-    // sort the gates in the increasing order of maximum delay
-    if ( pMan->nGates > 10000 )
-    {
-        printf( "Sorting array of %d supergates...\r", pMan->nGates );
-        fflush( stdout );
-    }
-    qsort( (void *)pMan->pGates, (size_t)pMan->nGates, sizeof(Super_Gate_t *), 
-            (int (*)(const void *, const void *)) Super_DelayCompare );
-    assert( Super_DelayCompare( pMan->pGates, pMan->pGates + pMan->nGates - 1 ) <= 0 );
-    if ( pMan->nGates > 10000 )
-    {
-        printf( "                                       \r" );
-    }
+    Super_PrepareArray( pMan );
 
     pProgress = Extra_ProgressBarStart( stdout, pMan->TimeLimit );
     pMan->TimePrint = Abc_Clock() + CLOCKS_PER_SEC;
@@ -386,49 +483,10 @@ Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGat
     {
         if ( fTimeOut ) break;
 
-        if ( fPrune )
-        {
-            if ( pMan->nLevels >= 1 )  // First level gates have been computed
-            {
-                if ( Mio_GateReadPinNum(ppGates[k]) >= iPruneLimitRoot )
-                    continue;
-            }
-        }
-/*
-        if ( strcmp(Mio_GateReadName(ppGates[k]), "MUX2IX0") == 0 )
-        {
-            int s = 0;
-        }
-*/
         // select the subset of gates to be considered with this root gate
-        // all the gates past this point will lead to delay larger than the limit
-        tDelayMio = (float)Mio_GateReadDelayMax(ppGates[k]);
-        for ( s = 0, t = 0; s < pMan->nGates; s++ )
-        {
-            if ( fPrune && ( pMan->nLevels >= 1 ) && ( ((int)pMan->pGates[s]->nFanins) >= iPruneLimit ))
-                continue;
-            
-            ppGatesLimit[t] = pMan->pGates[s];
-            if ( ppGatesLimit[t++]->tDelayMax + tDelayMio > pMan->tDelayMax && pMan->tDelayMax > 0.0 )
-                break;
-        }
-        nGatesLimit = t;
-
-        if ( pMan->fVerbose )
-        {
-            printf ("Trying %d choices for %d inputs\r", t, Mio_GateReadPinNum(ppGates[k]) );
-        }
-
-        // resort part of this range by area
-        // now we can prune the search by going up in the list until we reach the limit on area
-        // all the gates beyond this point can be skipped because their area can be only larger
-        if ( nGatesLimit > 10000 )
-            printf( "Sorting array of %d supergates...\r", nGatesLimit );
-        qsort( (void *)ppGatesLimit, (size_t)nGatesLimit, sizeof(Super_Gate_t *), 
-                (int (*)(const void *, const void *)) Super_AreaCompare );
-        assert( Super_AreaCompare( ppGatesLimit, ppGatesLimit + nGatesLimit - 1 ) <= 0 );
-        if ( nGatesLimit > 10000 )
-            printf( "                                       \r" );
+        nGatesLimit = Super_CollectLimit( pMan, ppGates[k], ppGatesLimit );
+        if ( nGatesLimit == -1 )
+            continue;
 
         // consider the combinations of gates with the root gate on top
         AreaMio = (float)Mio_GateReadArea(ppGates[k]);
@@ -723,6 +781,334 @@ done:
     return pMan;
 }
 
+#ifndef ABC_USE_PTHREADS
+
+Super_Man_t * Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv )
+{
+    return Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
+}
+
+#else // pthreads are used
+
+#define SUPER_THR_MAX   100
+
+// The threads enumerate the combinations of gates with the same root gate.
+// The combinations starting with the same fanin gate form one task. The
+// threads are started once and take the tasks from the shared counter,
+// deriving the truth tables and the delays of the candidate supergates.
+// This thread compares the candidates with the table in the order of the
+// tasks, so the result does not depend on the number of threads. At most
+// SUPER_WIN_MUL tasks per thread are done ahead of this thread, which
+// bounds the memory used by the candidates.
+
+#define SUPER_WIN_MUL   4
+
+typedef struct Super_Cand_t_ Super_Cand_t;
+struct Super_Cand_t_
+{
+    unsigned            uTruth[2];    // the truth table
+    Super_Gate_t *      pFanins[6];   // the fanins
+    float               Area;         // the area
+    float               ptDelays[6];  // the pin-to-pin delays
+    float               tDelayMax;    // the maximum delay
+};
+
+typedef struct Super_Task_t_ Super_Task_t;
+struct Super_Task_t_
+{
+    Super_Cand_t *      pCands;       // the candidates
+    int                 nCands;       // the number of candidates
+    int                 nCandsAlloc;  // the number of allocated candidates
+    int                 nTried;       // the number of combinations tried
+    int                 fTimeOut;     // the task was interrupted
+    int                 fDone;        // the task is ready to be compared
+};
+
+typedef struct Super_Par_t_ Super_Par_t;
+struct Super_Par_t_
+{
+    Super_Man_t *       pMan;         // the manager (read-only in the threads)
+    int                 fSkipInv;     // skipping inverters
+    // the current root gate
+    Mio_Gate_t *        pRoot;        // the root gate
+    Super_Gate_t **     ppGatesLimit; // the gates to be considered
+    int                 nGatesLimit;  // the number of gates (and tasks)
+    // the task queue
+    int                 iNext;        // the next task to be done
+    int                 iUsed;        // the number of tasks compared
+    int                 nBusy;        // the number of tasks being done
+    int                 fAbort;       // no more tasks should be started
+    int                 fStop;        // the threads should exit
+    int                 nWindow;      // the number of task slots
+    Super_Task_t *      pTasks;       // the task slots
+    pthread_mutex_t     Mutex;        // protects the fields above
+    pthread_cond_t      CondWork;     // signals new tasks or the stop
+    pthread_cond_t      CondDone;     // signals a finished task
+};
+
+typedef struct Super_ThData_t_ Super_ThData_t;
+struct Super_ThData_t_
+{
+    Super_Par_t *       pPar;         // the shared data
+    Super_Man_t *       pMan;         // the manager (read-only in the threads)
+    Mio_Gate_t *        pRoot;        // the root gate
+    Super_Gate_t **     ppGatesLimit; // the gates to be considered
+    int                 nGatesLimit;  // the number of gates
+    int                 nFanins;      // the number of root gate fanins
+    int                 fSkipInv;     // skipping inverters
+    int                 iTask;        // the first fanin gate
+    Super_Task_t *      pTask;        // the slot of the task
+    // the current combination
+    Super_Gate_t *      pSupers[6];
+    unsigned            uTruths[6][2];
+    float *             ptPinDelays[6];
+    int                 pIndex[6];
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Enumerates the combinations of fanin gates.]
+
+  Description [Follows the nested loops of Super_Compute().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Super_ThEnumerate_rec( Super_ThData_t * pTh, int iLevel, float AreaCur )
+{
+    Super_Man_t * pMan = pTh->pMan;
+    Super_Task_t * pTask = pTh->pTask;
+    Super_Gate_t * pGate;
+    Super_Cand_t * pCand;
+    float Area;
+    int i, k, fLast = (iLevel == pTh->nFanins - 1);
+    if ( iLevel >= 6 )
+    {
+        assert( 0 );
+        return;
+    }
+    Super_ManForEachGate( pTh->ppGatesLimit, pTh->nGatesLimit, i, pGate )
+    {
+        // the first fanin gate is fixed by the task
+        if ( iLevel == 0 && i != pTh->iTask )
+            continue;
+        for ( k = 0; k < iLevel; k++ )
+            if ( pTh->pIndex[k] == i )
+                break;
+        if ( k < iLevel )
+            continue;
+        if ( fLast )
+        {
+            if ( (++pTask->nTried & 0xFFF) == 0 && pMan->TimeStop && Abc_Clock() > pMan->TimeStop )
+            {
+                pTask->fTimeOut = 1;
+                return;
+            }
+            // skip the inverter as the root gate before the elementary variable
+            if ( pTh->nFanins == 1 && pTh->fSkipInv && pGate->tDelayMax == 0 )
+                continue;
+        }
+        // compute area
+        Area = AreaCur + pGate->Area;
+        if ( pMan->tAreaMax > 0.0 && Area > pMan->tAreaMax )
+            break;
+        pTh->pIndex[iLevel]      = i;
+        pTh->pSupers[iLevel]     = pGate;
+        pTh->uTruths[iLevel][0]  = pGate->uTruth[0];
+        pTh->uTruths[iLevel][1]  = pGate->uTruth[1];
+        pTh->ptPinDelays[iLevel] = pGate->ptDelays;
+        if ( !fLast )
+        {
+            Super_ThEnumerate_rec( pTh, iLevel + 1, Area );
+            if ( pTask->fTimeOut )
+                return;
+            continue;
+        }
+        // derive the candidate
+        if ( pTask->nCands == pTask->nCandsAlloc )
+        {
+            pTask->nCandsAlloc = pTask->nCandsAlloc ? 2 * pTask->nCandsAlloc : 1000;
+            pTask->pCands = ABC_REALLOC( Super_Cand_t, pTask->pCands, pTask->nCandsAlloc );
+        }
+        pCand = pTask->pCands + pTask->nCands++;
+        pCand->Area = Area;
+        memcpy( pCand->pFanins, pTh->pSupers, sizeof(Super_Gate_t *) * pTh->nFanins );
+        Mio_DeriveGateDelays( pTh->pRoot, pTh->ptPinDelays, pTh->nFanins, pMan->nVarsMax, SUPER_NO_VAR, pCand->ptDelays, &pCand->tDelayMax );
+        Mio_DeriveTruthTable( pTh->pRoot, pTh->uTruths, pTh->nFanins, pMan->nVarsMax, pCand->uTruth );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread taking the tasks from the queue.]
+
+  Description [The thread sleeps while there are no tasks or while it
+  is too far ahead of the thread comparing the candidates.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Super_WorkerThread( void * pArg )
+{
+    Super_ThData_t * pTh = (Super_ThData_t *)pArg;
+    Super_Par_t * pPar = pTh->pPar;
+    pthread_mutex_lock( &pPar->Mutex );
+    while ( 1 )
+    {
+        if ( pPar->fStop )
+            break;
+        if ( pPar->fAbort || pPar->iNext == pPar->nGatesLimit || pPar->iNext == pPar->iUsed + pPar->nWindow )
+        {
+            pthread_cond_wait( &pPar->CondWork, &pPar->Mutex );
+            continue;
+        }
+        // take the next task
+        pTh->iTask        = pPar->iNext++;
+        pTh->pTask        = pPar->pTasks + pTh->iTask % pPar->nWindow;
+        pTh->pMan         = pPar->pMan;
+        pTh->pRoot        = pPar->pRoot;
+        pTh->ppGatesLimit = pPar->ppGatesLimit;
+        pTh->nGatesLimit  = pPar->nGatesLimit;
+        pTh->nFanins      = Mio_GateReadPinNum(pPar->pRoot);
+        pTh->fSkipInv     = pPar->fSkipInv;
+        assert( !pTh->pTask->fDone );
+        assert( pTh->nFanins > 0 && pTh->nFanins <= 6 );
+        pPar->nBusy++;
+        pthread_mutex_unlock( &pPar->Mutex );
+        pTh->pTask->nCands   = 0;
+        pTh->pTask->nTried   = 0;
+        pTh->pTask->fTimeOut = 0;
+        Super_ThEnumerate_rec( pTh, 0, (float)Mio_GateReadArea(pTh->pRoot) );
+        pthread_mutex_lock( &pPar->Mutex );
+        pTh->pTask->fDone = 1;
+        pPar->nBusy--;
+        pthread_cond_signal( &pPar->CondDone );
+    }
+    pthread_mutex_unlock( &pPar->Mutex );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Precomputes one level of supergates using concurrent threads.]
+
+  Description [Computes the same supergates as Super_Compute(). The 
+  removed gates are not recycled because they may be used as fanins.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Super_Man_t * Super_ComputePar( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGates, int nGatesMax, int fSkipInv )
+{
+    Super_Par_t Par, * pPar = &Par;
+    Super_ThData_t * pThData;
+    pthread_t WorkerThread[SUPER_THR_MAX];
+    Super_Gate_t ** ppGatesLimit, * pGateNew;
+    Super_Task_t * pTask;
+    Super_Cand_t * pCand;
+    int i, k, t, status, nGatesLimit, nFanins, fTimeOut = 0;
+    int nProcs = Abc_MinInt( pMan->nProcs, SUPER_THR_MAX );
+
+    // the gates in the array may be referenced by the candidates
+    pMan->fKeepRemoved = 1;
+    Super_PrepareArray( pMan );
+    ppGatesLimit = ABC_ALLOC( Super_Gate_t *, pMan->nGates );
+    // start the threads
+    memset( pPar, 0, sizeof(Super_Par_t) );
+    pPar->pMan     = pMan;
+    pPar->fSkipInv = fSkipInv;
+    pPar->nWindow  = SUPER_WIN_MUL * nProcs;
+    pPar->pTasks   = ABC_CALLOC( Super_Task_t, pPar->nWindow );
+    status = pthread_mutex_init( &pPar->Mutex, NULL );     assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondWork, NULL );   assert( status == 0 );
+    status = pthread_cond_init( &pPar->CondDone, NULL );   assert( status == 0 );
+    pThData = ABC_CALLOC( Super_ThData_t, nProcs );
+    for ( t = 0; t < nProcs; t++ )
+    {
+        pThData[t].pPar = pPar;
+        status = pthread_create( WorkerThread + t, NULL, Super_WorkerThread, (void *)(pThData + t) );  assert( status == 0 );
+    }
+    for ( k = 0; k < nGates && !fTimeOut; k++ )
+    {
+        nGatesLimit = Super_CollectLimit( pMan, ppGates[k], ppGatesLimit );
+        if ( nGatesLimit == -1 )
+            continue;
+        nFanins = Mio_GateReadPinNum(ppGates[k]);
+        // give the tasks of this root gate to the threads
+        pthread_mutex_lock( &pPar->Mutex );
+        assert( pPar->nBusy == 0 );
+        pPar->pRoot        = ppGates[k];
+        pPar->ppGatesLimit = ppGatesLimit;
+        pPar->nGatesLimit  = nGatesLimit;
+        pPar->iNext        = 0;
+        pPar->iUsed        = 0;
+        pthread_cond_broadcast( &pPar->CondWork );
+        pthread_mutex_unlock( &pPar->Mutex );
+        // add the candidates to the table in the order of the tasks
+        for ( i = 0; i < nGatesLimit; i++ )
+        {
+            pTask = pPar->pTasks + i % pPar->nWindow;
+            pthread_mutex_lock( &pPar->Mutex );
+            while ( !pTask->fDone )
+                pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+            pthread_mutex_unlock( &pPar->Mutex );
+            pMan->nTried += pTask->nTried;
+            if ( pTask->fTimeOut )
+            {
+                fTimeOut = 1;
+                break;
+            }
+            for ( pCand = pTask->pCands; pCand < pTask->pCands + pTask->nCands; pCand++ )
+            {
+                if ( !Super_CompareGates( pMan, pCand->uTruth, pCand->Area, pCand->ptDelays, pMan->nVarsMax ) )
+                    continue;
+                pGateNew = Super_CreateGateNew( pMan, ppGates[k], pCand->pFanins, nFanins, pCand->uTruth, pCand->Area, pCand->ptDelays, pCand->tDelayMax, pMan->nVarsMax );
+                Super_AddGateToTable( pMan, pGateNew );
+                if ( nGatesMax && pMan->nClasses > nGatesMax )
+                    goto done;
+            }
+            // release the slot
+            pthread_mutex_lock( &pPar->Mutex );
+            pTask->fDone = 0;
+            pPar->iUsed++;
+            pthread_cond_broadcast( &pPar->CondWork );
+            pthread_mutex_unlock( &pPar->Mutex );
+        }
+    }
+    if ( fTimeOut )
+        printf ("Timeout!\n");
+done:
+    // wait for the started tasks and stop the threads
+    pthread_mutex_lock( &pPar->Mutex );
+    pPar->fAbort = 1;
+    while ( pPar->nBusy > 0 )
+        pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondWork );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( t = 0; t < nProcs; t++ )
+    {
+        status = pthread_join( WorkerThread[t], NULL );  assert( status == 0 );
+    }
+    pthread_cond_destroy( &pPar->CondWork );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    for ( t = 0; t < pPar->nWindow; t++ )
+        ABC_FREE( pPar->pTasks[t].pCands );
+    ABC_FREE( pPar->pTasks );
+    ABC_FREE( pThData );
+    ABC_FREE( ppGatesLimit );
+    return pMan;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Transfers gates from table into the array.]
@@ -881,7 +1267,8 @@ int Super_CompareGates( Super_Man_t * pMan, unsigned uTruth[], float Area, float
                 *ppList = pGate->pNext;
             else
                 pPrev->pNext = pGate->pNext;
-            Extra_MmFixedEntryRecycle( pMan->pMem, (char *)pGate );
+            if ( !pMan->fKeepRemoved )
+                Extra_MmFixedEntryRecycle( pMan->pMem, (char *)pGate );
             pMan->nRemoved++;
         }
         else if ( fGateIsBetter ) // new is worse, already dominated no need to see others
@@ -21,6 +21,17 @@
 #include "cgtInt.h"
 #include "misc/bar/bar.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,6 +39,24 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CGT_THR_MAX 64
+
+#ifdef ABC_USE_PTHREADS
+
+// information given to the thread
+typedef struct Cgt_ThData_t_
+{
+    Cgt_Man_t *      pShared;      // the manager with the shared AIGs
+    Cgt_Man_t *      pMan;         // the manager with the SAT solver of this thread
+    int *            piNext;       // the first flop of the next range
+    Bar_Progress_t * pProgress;    // the progress bar updated by this thread
+} Cgt_ThData_t;
+
+// mutex to control access to the shared AIGs
+static pthread_mutex_t g_CgtMutex = PTHREAD_MUTEX_INITIALIZER;
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -52,6 +81,7 @@ void Cgt_SetDefaultParams( Cgt_Par_t * p )
     p->nConfMax   =    10;   // the max number of conflicts at a node
     p->nVarsMin   =  1000;   // the min number of vars to recycle the SAT solver
     p->nFlopsMin  =    10;   // the min number of flops to recycle the SAT solver
+    p->nProcs     =     1;   // the number of threads checking the candidates
     p->fAreaOnly  =     0;   // derive clock-gating to minimize area
     p->fVerbose   =     0;   // verbosity flag
 }
@@ -118,36 +148,66 @@ void Cgt_SimulationRecord( Cgt_Man_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    [Performs clock-gating for the AIG.]
+  Synopsis    [Collects the candidates of the flops in the partition.]
 
-  Description []
+  Description [For each register input in the range, vCands contains
+  the miter in the partition, followed by the pairs of the candidate in
+  the AIG and its copy in the partition, terminated by NULL. The copies
+  are found using the pData fields of the AIG and of the clock-gating
+  miter, which are overwritten when the next partition is derived.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cgt_ClockGatingRangeCheck( Cgt_Man_t * p, int iStart, int nOutputs )
+void Cgt_ClockGatingRangeCollect( Cgt_Man_t * p, int iStart, int nOutputs, Vec_Ptr_t * vCands )
 {
     Vec_Ptr_t * vNodes = p->vFanout;
-    Aig_Obj_t * pMiter, * pCand, * pMiterFrame, * pCandFrame, * pMiterPart, * pCandPart;
-    int i, k, RetValue, nCalls;
-    assert( Vec_VecSize(p->vGatesAll) == Aig_ManCoNum(p->pFrame) );
-    // go through all the registers inputs of this range
+    Aig_Obj_t * pMiter, * pCand, * pMiterFrame, * pCandFrame;
+    int i, k;
+    Vec_PtrClear( vCands );
     for ( i = iStart; i < iStart + nOutputs; i++ )
     {
-        nCalls = p->nCalls;
         pMiter = Saig_ManLi( p->pAig, i );
+        pMiterFrame = (Aig_Obj_t *)pMiter->pData;
+        Vec_PtrPush( vCands, pMiterFrame->pData );
         Cgt_ManDetectCandidates( p->pAig, p->vUseful, Aig_ObjFanin0(pMiter), p->pPars->nLevelMax, vNodes );
-        // go through the candidates of this PO
         Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pCand, k )
         {
-            // get the corresponding nodes from the frames
-            pCandFrame  = (Aig_Obj_t *)pCand->pData;
-            pMiterFrame = (Aig_Obj_t *)pMiter->pData;
-            // get the corresponding nodes from the part
-            pCandPart   = (Aig_Obj_t *)pCandFrame->pData;
-            pMiterPart  = (Aig_Obj_t *)pMiterFrame->pData;
+            pCandFrame = (Aig_Obj_t *)pCand->pData;
+            Vec_PtrPush( vCands, pCand );
+            Vec_PtrPush( vCands, pCandFrame->pData );
+        }
+        Vec_PtrPush( vCands, NULL );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs clock-gating for the AIG.]
+
+  Description [Checks the candidates collected by the above procedure
+  using the SAT solver of the partition.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cgt_ClockGatingRangeCheck( Cgt_Man_t * p, int iStart, Vec_Ptr_t * vCands )
+{
+    Aig_Obj_t * pCand, * pMiterPart, * pCandPart;
+    int i, k, RetValue;
+    assert( Vec_VecSize(p->vGatesAll) == Saig_ManRegNum(p->pAig) );
+    // go through all the registers inputs of this range
+    for ( i = iStart, k = 0; k < Vec_PtrSize(vCands); i++, k++ )
+    {
+        pMiterPart = (Aig_Obj_t *)Vec_PtrEntry( vCands, k++ );
+        // go through the candidates of this PO
+        for ( ; (pCand = (Aig_Obj_t *)Vec_PtrEntry(vCands, k)); k += 2 )
+        {
+            pCandPart = (Aig_Obj_t *)Vec_PtrEntry( vCands, k+1 );
             // try direct polarity
             if ( Cgt_SimulationFilter( p, pCandPart, pMiterPart ) )
             {
@@ -177,13 +237,6 @@ void Cgt_ClockGatingRangeCheck( Cgt_Man_t * p, int iStart, int nOutputs )
             else
                 p->nCallsFiltered++;
         }
-
-        if ( p->pPars->fVerbose )
-        {
-//            printf( "Flop %3d : Cand = %4d. Gate = %4d. SAT calls = %3d.\n", 
-//                i, Vec_PtrSize(vNodes), Vec_PtrSize(Vec_VecEntry(p->vGatesAll, i)), p->nCalls-nCalls );
-        }
-
     }
 } 
 
@@ -191,35 +244,34 @@ void Cgt_ClockGatingRangeCheck( Cgt_Man_t * p, int iStart, int nOutputs )
 
   Synopsis    [Performs clock-gating for the AIG.]
 
-  Description []
+  Description [The partition should be derived before calling this
+  procedure. Loads the partition into a new SAT solver and checks the
+  candidates of its flops.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Cgt_ClockGatingRange( Cgt_Man_t * p, int iStart )
+void Cgt_ClockGatingRangeSolve( Cgt_Man_t * p, int iStart, int nOutputs, Vec_Ptr_t * vCands )
 {
-    int nOutputs, iStop;
     abctime clk, clkTotal = Abc_Clock();
     int nCallsUnsat    = p->nCallsUnsat;
     int nCallsSat      = p->nCallsSat;
     int nCallsUndec    = p->nCallsUndec;
     int nCallsFiltered = p->nCallsFiltered;
 clk = Abc_Clock();
-    p->pPart = Cgt_ManDupPartition( p->pFrame, p->pPars->nVarsMin, p->pPars->nFlopsMin, iStart, p->pCare, p->vSuppsInv, &nOutputs );
     p->pCnf  = Cnf_DeriveSimple( p->pPart, nOutputs );
     p->pSat  = (sat_solver *)Cnf_DataWriteIntoSolver( p->pCnf, 1, 0 );
     sat_solver_compress( p->pSat );
     p->vPatts = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(p->pPart), p->nPattWords );
     Vec_PtrCleanSimInfo( p->vPatts, 0, p->nPattWords );
 p->timePrepare += Abc_Clock() - clk;
-    Cgt_ClockGatingRangeCheck( p, iStart, nOutputs );
-    iStop = iStart + nOutputs;
+    Cgt_ClockGatingRangeCheck( p, iStart, vCands );
     if ( p->pPars->fVeryVerbose )
     {
         printf( "%5d : D =%4d. C =%5d. Var =%6d. Pr =%5d. Cex =%5d. F =%4d. Saved =%6d. ",
-            iStart, iStop-iStart, Aig_ManCoNum(p->pPart)-nOutputs, p->pSat->size, 
+            iStart, nOutputs, Aig_ManCoNum(p->pPart)-nOutputs, p->pSat->size, 
             p->nCallsUnsat-nCallsUnsat, 
             p->nCallsSat  -nCallsSat, 
             p->nCallsUndec-nCallsUndec,
@@ -228,9 +280,137 @@ p->timePrepare += Abc_Clock() - clk;
     }
     Cgt_ManClean( p );
     p->nRecycles++;
-    return iStop;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs clock-gating for the AIG.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cgt_ClockGatingRange( Cgt_Man_t * p, int iStart )
+{
+    int nOutputs;
+    abctime clk = Abc_Clock();
+    p->pPart = Cgt_ManDupPartition( p->pFrame, p->pPars->nVarsMin, p->pPars->nFlopsMin, iStart, p->pCare, p->vSuppsInv, &nOutputs );
+    Cgt_ClockGatingRangeCollect( p, iStart, nOutputs, p->vCands );
+p->timePrepare += Abc_Clock() - clk;
+    Cgt_ClockGatingRangeSolve( p, iStart, nOutputs, p->vCands );
+    return iStart + nOutputs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs clock-gating for the AIG on several threads.]
+
+  Description [Each thread takes the next range of flops, derives its
+  partition (including the care set) and collects the candidates. This
+  step uses the shared AIGs and is done by one thread at a time. After
+  that, the thread checks the candidates using its own SAT solver and
+  simulation patterns. The results are the same as when the ranges are
+  processed by one thread because the ranges do not depend on each other
+  and the gates of different flops are stored in different entries of
+  vGatesAll.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Cgt_WorkerThread( void * pArg )
+{
+    Cgt_ThData_t * pThData = (Cgt_ThData_t *)pArg;
+    Cgt_Man_t * p = pThData->pMan, * pMan = pThData->pShared;
+    int iStart, nOutputs, status;
+    abctime clk;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock(&g_CgtMutex);  assert( status == 0 );
+        iStart = *pThData->piNext;
+        if ( iStart == Aig_ManCoNum(pMan->pFrame) )
+        {
+            status = pthread_mutex_unlock(&g_CgtMutex);  assert( status == 0 );
+            break;
+        }
+        if ( pThData->pProgress )
+            Bar_ProgressUpdate( pThData->pProgress, iStart, NULL );
+clk = Abc_Clock();
+        p->pPart = Cgt_ManDupPartition( pMan->pFrame, pMan->pPars->nVarsMin, pMan->pPars->nFlopsMin, iStart, pMan->pCare, pMan->vSuppsInv, &nOutputs );
+        Cgt_ClockGatingRangeCollect( pMan, iStart, nOutputs, p->vCands );
+p->timePrepare += Abc_Clock() - clk;
+        *pThData->piNext = iStart + nOutputs;
+        status = pthread_mutex_unlock(&g_CgtMutex);  assert( status == 0 );
+        Cgt_ClockGatingRangeSolve( p, iStart, nOutputs, p->vCands );
+    }
+    return NULL;
+}
+void Cgt_ClockGatingRangesPar( Cgt_Man_t * p, Bar_Progress_t * pProgress )
+{
+    Cgt_ThData_t ThData[CGT_THR_MAX];
+    pthread_t WorkerThread[CGT_THR_MAX];
+    int i, status, iNext = 0, nProcs = Abc_MinInt( p->pPars->nProcs, CGT_THR_MAX );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pShared   = p;
+        ThData[i].pMan      = ABC_CALLOC( Cgt_Man_t, 1 );
+        ThData[i].pMan->pPars      = p->pPars;
+        ThData[i].pMan->pAig       = p->pAig;
+        ThData[i].pMan->vGatesAll  = p->vGatesAll;
+        ThData[i].pMan->vCands     = Vec_PtrAlloc( 1000 );
+        ThData[i].pMan->nPattWords = p->nPattWords;
+        ThData[i].piNext    = &iNext;
+        ThData[i].pProgress = i ? NULL : pProgress;
+    }
+    // the calling thread is one of the workers
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cgt_WorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Cgt_WorkerThread( (void *)ThData );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    // collect the statistics
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Cgt_Man_t * pMan = ThData[i].pMan;
+        p->nRecycles      += pMan->nRecycles;
+        p->nCalls         += pMan->nCalls;
+        p->nCallsSat      += pMan->nCallsSat;
+        p->nCallsUnsat    += pMan->nCallsUnsat;
+        p->nCallsUndec    += pMan->nCallsUndec;
+        p->nCallsFiltered += pMan->nCallsFiltered;
+        p->timePrepare    += pMan->timePrepare;
+        p->timeSat        += pMan->timeSat;
+        p->timeSatSat     += pMan->timeSatSat;
+        p->timeSatUnsat   += pMan->timeSatUnsat;
+        p->timeSatUndec   += pMan->timeSatUndec;
+        Cgt_ManClean( pMan );
+        Vec_PtrFree( pMan->vCands );
+        ABC_FREE( pMan );
+    }
+}
+#else
+void Cgt_ClockGatingRangesPar( Cgt_Man_t * p, Bar_Progress_t * pProgress )
+{
+    int iStart;
+    for ( iStart = 0; iStart < Aig_ManCoNum(p->pFrame); )
+    {
+        Bar_ProgressUpdate( pProgress, iStart, NULL );
+        iStart = Cgt_ClockGatingRange( p, iStart );
+    }
+}
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Performs clock-gating for the AIG.]
@@ -260,10 +440,15 @@ Vec_Vec_t * Cgt_ClockGatingCandidates( Aig_Man_t * pAig, Aig_Man_t * pCare, Cgt_
 p->timeAig += Abc_Clock() - clk;
     assert( Aig_ManCoNum(p->pFrame) == Saig_ManRegNum(p->pAig) );
     pProgress = Bar_ProgressStart( stdout, Aig_ManCoNum(p->pFrame) );
-    for ( iStart = 0; iStart < Aig_ManCoNum(p->pFrame); )
+    if ( pPars->nProcs > 1 )
+        Cgt_ClockGatingRangesPar( p, pProgress );
+    else
     {
-        Bar_ProgressUpdate( pProgress, iStart, NULL );
-        iStart = Cgt_ClockGatingRange( p, iStart );
+        for ( iStart = 0; iStart < Aig_ManCoNum(p->pFrame); )
+        {
+            Bar_ProgressUpdate( pProgress, iStart, NULL );
+            iStart = Cgt_ClockGatingRange( p, iStart );
+        }
     }
     Bar_ProgressStop( pProgress );
     vGatesAll = p->vGatesAll;
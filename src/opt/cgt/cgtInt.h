@@ -61,6 +61,7 @@ struct Cgt_Man_t_
     Aig_Man_t *  pFrame;         // clock gate AIG manager
     Vec_Ptr_t *  vFanout;        // temporary storage for fanouts
     Vec_Ptr_t *  vVisited;       // temporary storage for visited nodes
+    Vec_Ptr_t *  vCands;         // the candidates of the flops in the partition
     // SAT solving
     Aig_Man_t *  pPart;          // partition
     Cnf_Dat_t *  pCnf;           // CNF of the partition
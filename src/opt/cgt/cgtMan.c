@@ -57,6 +57,7 @@ Cgt_Man_t * Cgt_ManCreate( Aig_Man_t * pAig, Aig_Man_t * pCare, Cgt_Par_t * pPar
     p->vGatesAll  = Vec_VecStart( Saig_ManRegNum(pAig) );
     p->vFanout    = Vec_PtrAlloc( 1000 );
     p->vVisited   = Vec_PtrAlloc( 1000 );
+    p->vCands     = Vec_PtrAlloc( 1000 );
     p->nPattWords = 16;
     if ( pCare == NULL )
         return p;
@@ -160,6 +161,7 @@ void Cgt_ManStop( Cgt_Man_t * p )
     Cgt_ManClean( p );
     Vec_PtrFree( p->vFanout );
     Vec_PtrFree( p->vVisited );
+    Vec_PtrFree( p->vCands );
     if ( p->vGates )
         Vec_PtrFree( p->vGates );
     if ( p->vGatesAll )
@@ -60,6 +60,7 @@ typedef enum {
 
 typedef struct Dss_Man_t_ Dss_Man_t;
 typedef struct Abc_TtHieMan_t_ Abc_TtHieMan_t;
+typedef struct Abc_TtBatch_t_ Abc_TtBatch_t;
 typedef unsigned(*TtCanonicizeFunc)(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 
 ////////////////////////////////////////////////////////////////////////
@@ -87,6 +88,13 @@ extern void          Abc_TtHieManStop(Abc_TtHieMan_t * p );
 extern unsigned      Abc_TtCanonicizeWrap(TtCanonicizeFunc func, Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 extern unsigned      Abc_TtCanonicizeAda(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int iThres);
 extern unsigned      Abc_TtCanonicizeHie(Abc_TtHieMan_t * p, word * pTruthInit, int nVars, char * pCanonPerm, int fExact);
+/*=== dauBatch.c ==========================================================*/
+extern Abc_TtBatch_t * Abc_TtBatchStart( int nVars, int nProcs );
+extern void          Abc_TtBatchStop( Abc_TtBatch_t * p );
+extern int           Abc_TtBatchClassNum( Abc_TtBatch_t * p );
+extern word *        Abc_TtBatchClass( Abc_TtBatch_t * p, int iClass );
+extern void          Abc_TtBatchPrintStats( Abc_TtBatch_t * p );
+extern Vec_Int_t *   Abc_TtBatchCanonicize( Abc_TtBatch_t * p, word * pTruths, int nFuncs );
 /*=== dauCount.c ==========================================================*/
 extern int           Abc_TtCountOnesInCofsQuick( word * pTruth, int nVars, int * pStore );
 /*=== dauDsd.c  ==========================================================*/
@@ -0,0 +1,233 @@
+/**CFile****************************************************************
+
+  FileName    [dauBatch.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Canonicization of arrays of truth tables.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: dauBatch.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+#include "misc/vec/vecMem.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DAU_BATCH_THR_MAX 100
+
+struct Abc_TtBatch_t_
+{
+    int              nVars;        // the number of variables
+    int              nWords;       // the number of words in the truth tables
+    int              nProcs;       // the number of threads
+    Vec_Mem_t *      vFuncs;       // functions seen so far
+    Vec_Int_t *      vFunc2Class;  // the class of each function
+    Vec_Mem_t *      vClasses;     // canonical forms of the classes
+    // statistics
+    int              nCalls;       // the number of functions looked up
+    int              nCanons;      // the number of functions canonicized
+};
+
+typedef struct Abc_TtBatchThData_t_ Abc_TtBatchThData_t;
+struct Abc_TtBatchThData_t_
+{
+    word *           pFuncs;       // functions to be canonicized in place
+    int              nFuncs;       // the number of functions
+    int              nVars;        // the number of variables
+    int              iThread;      // this thread takes every nProcs-th function
+    int              nProcs;       // the number of threads
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the batch canonicizer.]
+
+  Description [The manager remembers the class of every function it has
+  seen, so that functions repeated within one batch or across batches
+  are canonicized only once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_TtBatch_t * Abc_TtBatchStart( int nVars, int nProcs )
+{
+    Abc_TtBatch_t * p;
+    assert( nVars <= 16 );
+    p = ABC_CALLOC( Abc_TtBatch_t, 1 );
+    p->nVars       = nVars;
+    p->nWords      = Abc_TtWordNum( nVars );
+    p->nProcs      = Abc_MaxInt( 1, Abc_MinInt(nProcs, DAU_BATCH_THR_MAX) );
+    p->vFuncs      = Vec_MemAlloc( p->nWords, 12 );
+    p->vFunc2Class = Vec_IntAlloc( 1000 );
+    p->vClasses    = Vec_MemAlloc( p->nWords, 12 );
+    Vec_MemHashAlloc( p->vFuncs, 10000 );
+    Vec_MemHashAlloc( p->vClasses, 10000 );
+    return p;
+}
+void Abc_TtBatchStop( Abc_TtBatch_t * p )
+{
+    Vec_MemHashFree( p->vFuncs );
+    Vec_MemFree( p->vFuncs );
+    Vec_MemHashFree( p->vClasses );
+    Vec_MemFree( p->vClasses );
+    Vec_IntFree( p->vFunc2Class );
+    ABC_FREE( p );
+}
+int Abc_TtBatchClassNum( Abc_TtBatch_t * p )
+{
+    return Vec_MemEntryNum( p->vClasses );
+}
+word * Abc_TtBatchClass( Abc_TtBatch_t * p, int iClass )
+{
+    return Vec_MemReadEntry( p->vClasses, iClass );
+}
+void Abc_TtBatchPrintStats( Abc_TtBatch_t * p )
+{
+    printf( "Functions = %d.  Unique = %d.  Canonicized = %d.  Classes = %d.\n",
+        p->nCalls, Vec_MemEntryNum(p->vFuncs), p->nCanons, Vec_MemEntryNum(p->vClasses) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Canonicizes an array of functions.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtBatchCanonRange( word * pFuncs, int nFuncs, int nVars, int iStart, int nStep )
+{
+    char pCanonPerm[16];
+    int i, nWords = Abc_TtWordNum( nVars );
+    for ( i = iStart; i < nFuncs; i += nStep )
+        Abc_TtCanonicize( pFuncs + i * nWords, nVars, pCanonPerm );
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Abc_TtBatchWorkerThread( void * pArg )
+{
+    Abc_TtBatchThData_t * pThData = (Abc_TtBatchThData_t *)pArg;
+    Abc_TtBatchCanonRange( pThData->pFuncs, pThData->nFuncs, pThData->nVars, pThData->iThread, pThData->nProcs );
+    return NULL;
+}
+static void Abc_TtBatchCanonArray( word * pFuncs, int nFuncs, int nVars, int nProcs )
+{
+    Abc_TtBatchThData_t ThData[DAU_BATCH_THR_MAX];
+    pthread_t WorkerThread[DAU_BATCH_THR_MAX];
+    int i, status;
+    nProcs = Abc_MinInt( nProcs, nFuncs / 16 );
+    if ( nProcs < 2 )
+    {
+        Abc_TtBatchCanonRange( pFuncs, nFuncs, nVars, 0, 1 );
+        return;
+    }
+    // the calling thread takes the first share of the functions
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[i].pFuncs  = pFuncs;
+        ThData[i].nFuncs  = nFuncs;
+        ThData[i].nVars   = nVars;
+        ThData[i].iThread = i;
+        ThData[i].nProcs  = nProcs;
+        status = pthread_create( WorkerThread + i, NULL, Abc_TtBatchWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Abc_TtBatchCanonRange( pFuncs, nFuncs, nVars, 0, nProcs );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+#else
+static void Abc_TtBatchCanonArray( word * pFuncs, int nFuncs, int nVars, int nProcs )
+{
+    Abc_TtBatchCanonRange( pFuncs, nFuncs, nVars, 0, 1 );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the NPN class of each function in the array.]
+
+  Description [The functions are stored one after another, each using
+  Abc_TtWordNum(nVars) words. First, the functions are looked up in the
+  table of functions seen before. Next, the new ones are canonicized
+  (on concurrent threads, if requested) using Abc_TtCanonicize(). Finally,
+  their canonical forms are hashed into the table of classes in the order
+  of their first appearance, so the class numbers do not depend on the
+  number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Abc_TtBatchCanonicize( Abc_TtBatch_t * p, word * pTruths, int nFuncs )
+{
+    Vec_Int_t * vRes = Vec_IntAlloc( nFuncs );
+    int i, iFunc, iFirst = Vec_MemEntryNum( p->vFuncs );
+    word * pNew;
+    // find the functions not seen before
+    for ( i = 0; i < nFuncs; i++ )
+        Vec_IntPush( vRes, Vec_MemHashInsert(p->vFuncs, pTruths + i * p->nWords) );
+    p->nCalls += nFuncs;
+    // canonicize the new ones
+    nFuncs = Vec_MemEntryNum(p->vFuncs) - iFirst;
+    pNew = ABC_ALLOC( word, nFuncs * p->nWords );
+    for ( i = 0; i < nFuncs; i++ )
+        Abc_TtCopy( pNew + i * p->nWords, Vec_MemReadEntry(p->vFuncs, iFirst + i), p->nWords, 0 );
+    Abc_TtBatchCanonArray( pNew, nFuncs, p->nVars, p->nProcs );
+    p->nCanons += nFuncs;
+    // record their classes
+    for ( i = 0; i < nFuncs; i++ )
+        Vec_IntPush( p->vFunc2Class, Vec_MemHashInsert(p->vClasses, pNew + i * p->nWords) );
+    assert( Vec_IntSize(p->vFunc2Class) == Vec_MemEntryNum(p->vFuncs) );
+    ABC_FREE( pNew );
+    Vec_IntForEachEntry( vRes, iFunc, i )
+        Vec_IntWriteEntry( vRes, i, Vec_IntEntry(p->vFunc2Class, iFunc) );
+    return vRes;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -107,6 +107,8 @@ struct Fxch_Man_t_
 
     Vec_Int_t*    vLevels;       /* variable levels */
 
+    int           nProcs;        /* the number of threads for divisor counting */
+
     // Cube Grouping
     Vec_Int_t* vTranslation;
     Vec_Int_t* vOutputID;
@@ -154,8 +156,8 @@ static inline int Fxch_CountOnes( unsigned num )
 }
 
 /*===== Fxch.c =======================================================*/
-int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose );
-int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int fVerbose, int fVeryVerbose );
+int Abc_NtkFxchPerform( Abc_Ntk_t* pNtk, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
+int Fxch_FastExtract( Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int nProcs, int fVerbose, int fVeryVerbose );
 
 /*===== FxchDiv.c ====================================================================================================*/
 int  Fxch_DivCreate( Fxch_Man_t* pFxchMan,  Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1 );
@@ -181,6 +183,9 @@ void  Fxch_ManUpdate( Fxch_Man_t* pFxchMan, int iDiv );
 void  Fxch_ManPrintDivs( Fxch_Man_t* pFxchMan );
 void  Fxch_ManPrintStats( Fxch_Man_t* pFxchMan );
 
+/*===== FxchPth.c ====================================================================================================*/
+Vec_Ptr_t* Fxch_ManSCHashTablesFillPar( Fxch_Man_t* pFxchMan );
+
 static inline Vec_Int_t* Fxch_ManGetCube( Fxch_Man_t* pFxchMan,
                                           int iCube )
 {
@@ -216,6 +221,26 @@ int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
                             uint32_t iLit1,
                             char fUpdate );
 
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable, uint32_t SubCubeID );
+
+void Fxch_SCHashTableInsertCollect( Fxch_SCHashTable_t* pSCHashTable,
+                                    Vec_Wec_t* vCubes,
+                                    uint32_t BinID,
+                                    uint32_t SubCubeID,
+                                    uint32_t iCube,
+                                    uint32_t iLit0,
+                                    uint32_t iLit1,
+                                    int Seq,
+                                    Vec_Int_t* vSubCube0,
+                                    Vec_Int_t* vSubCube1,
+                                    Vec_Int_t* vMatches );
+
+int Fxch_SCHashTablePairAdd( Fxch_SCHashTable_t* pSCHashTable,
+                             uint32_t BinID,
+                             int iEntry0,
+                             int iEntry1,
+                             char fUpdate );
+
 unsigned int Fxch_SCHashTableMemory( Fxch_SCHashTable_t* );
 void Fxch_SCHashTablePrint( Fxch_SCHashTable_t* );
 
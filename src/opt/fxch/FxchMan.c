@@ -285,19 +285,79 @@ void Fxch_ManSCHashTablesFree( Fxch_Man_t* pFxchMan )
     Fxch_SCHashTableDelete( pFxchMan->pSCHashTable );
 }
 
+/* Adds the divisors of the sub-cube matches collected by the threads.
+ * The matches are processed in the order in which the sequential code
+ * inserts the sub-cubes, so the divisors are numbered the same way. */
+static inline void Fxch_ManDivCreateMatches( Fxch_Man_t* pFxchMan,
+                                             Vec_Ptr_t* vMatches )
+{
+    Vec_Int_t* vCube,
+             * vThis;
+    int* pPos = ABC_CALLOC( int, Vec_PtrSize( vMatches ) );
+    int i, iCube,
+        iBest,
+        Seq = 0,
+        SeqLimit = 0;
+
+    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+    {
+        Fxch_ManDivSingleCube( pFxchMan, iCube, 1, 0 );
+
+        /* sub-cubes of this cube have numbers below the limit */
+        SeqLimit += 1 + ( Vec_IntSize( vCube ) - 1 ) * Vec_IntSize( vCube ) / 2;
+        while ( 1 )
+        {
+            iBest = -1;
+            Vec_PtrForEachEntry( Vec_Int_t*, vMatches, vThis, i )
+                if ( pPos[i] < Vec_IntSize( vThis ) && Vec_IntEntry( vThis, pPos[i] ) < SeqLimit &&
+                     ( iBest == -1 || Vec_IntEntry( vThis, pPos[i] ) < Seq ) )
+                {
+                    iBest = i;
+                    Seq = Vec_IntEntry( vThis, pPos[i] );
+                }
+            if ( iBest == -1 )
+                break;
+
+            /* all matches of one sub-cube come from the thread owning its bin */
+            vThis = (Vec_Int_t*)Vec_PtrEntry( vMatches, iBest );
+            for ( ; pPos[iBest] < Vec_IntSize( vThis ) && Vec_IntEntry( vThis, pPos[iBest] ) == Seq; pPos[iBest] += 4 )
+                pFxchMan->nPairsD += Fxch_SCHashTablePairAdd( pFxchMan->pSCHashTable,
+                                                              Vec_IntEntry( vThis, pPos[iBest] + 1 ),
+                                                              Vec_IntEntry( vThis, pPos[iBest] + 2 ),
+                                                              Vec_IntEntry( vThis, pPos[iBest] + 3 ), 0 );
+        }
+    }
+    pFxchMan->pSCHashTable->nEntries += SeqLimit;
+
+    Vec_PtrForEachEntry( Vec_Int_t*, vMatches, vThis, i )
+    {
+        assert( pPos[i] == Vec_IntSize( vThis ) );
+        Vec_IntFree( vThis );
+    }
+    Vec_PtrFree( vMatches );
+    ABC_FREE( pPos );
+}
+
 void Fxch_ManDivCreate( Fxch_Man_t* pFxchMan )
 {
+    Vec_Ptr_t* vMatches = NULL;
     Vec_Int_t* vCube;
     float Weight;
     int fAdd = 1,
         fUpdate = 0,
         iCube;
 
-    Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
-    {
-        Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
-        Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
-    }
+    if ( pFxchMan->nProcs > 1 )
+        vMatches = Fxch_ManSCHashTablesFillPar( pFxchMan );
+
+    if ( vMatches )
+        Fxch_ManDivCreateMatches( pFxchMan, vMatches );
+    else
+        Vec_WecForEachLevel( pFxchMan->vCubes, vCube, iCube )
+        {
+            Fxch_ManDivSingleCube( pFxchMan, iCube, fAdd, fUpdate );
+            Fxch_ManDivDoubleCube( pFxchMan, iCube, fAdd, fUpdate );
+        }
 
     pFxchMan->vDivPrio = Vec_QueAlloc( Vec_FltSize( pFxchMan->vDivWeights ) );
     Vec_QueSetPriority( pFxchMan->vDivPrio, Vec_FltArrayP( pFxchMan->vDivWeights ) );
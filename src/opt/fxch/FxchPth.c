@@ -0,0 +1,192 @@
+/**CFile****************************************************************
+
+  FileName    [ FxchPth.c ]
+
+  PackageName [ Fast eXtract with Cube Hashing (FXCH) ]
+
+  Synopsis    [ Concurrent construction of the sub-cube hash table ]
+
+  Author      [ Bruno Schmitt - boschmitt at inf.ufrgs.br ]
+
+  Affiliation [ UFRGS ]
+
+  Date        [ Ver. 1.0. Started - October 18, 2026. ]
+
+  Revision    []
+
+***********************************************************************/
+#include "Fxch.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Vec_Ptr_t* Fxch_ManSCHashTablesFillPar( Fxch_Man_t* pFxchMan ) { return NULL; }
+
+#else // pthreads are used
+
+#define FXCH_THR_MAX 100
+
+typedef struct Fxch_ThData_t_ Fxch_ThData_t;
+struct Fxch_ThData_t_
+{
+    Fxch_Man_t* pFxchMan;   /* the manager (read-only in the threads) */
+    int         iThread;    /* this thread owns bins with this remainder */
+    int         nProcs;     /* the number of threads */
+    Vec_Int_t*  vSubCube0;  /* temporary sub-cubes */
+    Vec_Int_t*  vSubCube1;
+    Vec_Int_t*  vMatches;   /* collected sub-cube matches */
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+static inline void Fxch_ThInsert( Fxch_ThData_t* pTh,
+                                  uint32_t SubCubeID,
+                                  int iCube,
+                                  int iLit0,
+                                  int iLit1,
+                                  int Seq )
+{
+    Fxch_Man_t* pFxchMan = pTh->pFxchMan;
+    unsigned int BinID = Fxch_SCHashTableBinId( pFxchMan->pSCHashTable, SubCubeID );
+
+    if ( (int)( BinID % pTh->nProcs ) != pTh->iThread )
+        return;
+
+    Fxch_SCHashTableInsertCollect( pFxchMan->pSCHashTable, pFxchMan->vCubes,
+                                   BinID, SubCubeID, iCube, iLit0, iLit1, Seq,
+                                   pTh->vSubCube0, pTh->vSubCube1, pTh->vMatches );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [ Worker thread filling its bins of the sub-cube hash table. ]
+
+  Description [ Every thread enumerates all sub-cubes in the same order
+                as Fxch_ManDivDoubleCube() and numbers them, but inserts
+                only those falling into its own bins. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Fxch_ManSCHashTablesWorkerThread( void* pArg )
+{
+    Fxch_ThData_t* pTh = (Fxch_ThData_t*)pArg;
+    Vec_Int_t* vLitHashKeys = pTh->pFxchMan->vLitHashKeys,
+             * vCube;
+    int iCube,
+        Seq = 0;
+
+    Vec_WecForEachLevel( pTh->pFxchMan->vCubes, vCube, iCube )
+    {
+        int SubCubeID = 0,
+            iLit0,
+            Lit0;
+
+        Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+            SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+
+        Fxch_ThInsert( pTh, SubCubeID, iCube, 0, 0, Seq++ );
+
+        Vec_IntForEachEntryStart( vCube, Lit0, iLit0, 1)
+        {
+            int Lit1,
+                iLit1;
+
+            /* 1 Lit remove */
+            SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit0 );
+
+            Fxch_ThInsert( pTh, SubCubeID, iCube, iLit0, 0, Seq++ );
+
+            /* 2 Lit remove */
+            Vec_IntForEachEntryStart( vCube, Lit1, iLit1, iLit0 + 1)
+            {
+                SubCubeID -= Vec_IntEntry( vLitHashKeys, Lit1 );
+                Fxch_ThInsert( pTh, SubCubeID, iCube, iLit0, iLit1, Seq++ );
+                SubCubeID += Vec_IntEntry( vLitHashKeys, Lit1 );
+            }
+
+            SubCubeID += Vec_IntEntry( vLitHashKeys, Lit0 );
+        }
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [ Fills the sub-cube hash table using concurrent threads. ]
+
+  Description [ The bins of the table are distributed among the threads,
+                so that each thread inserts sub-cubes and compares them
+                with earlier sub-cubes in its own bins only. The
+                resulting table is the same as the one built by the
+                sequential code. The divisors are not created here;
+                instead, each thread returns the array of matches, which
+                are turned into divisors by Fxch_ManDivCreate() in the
+                sequential order. Returns NULL if threads are not used. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t* Fxch_ManSCHashTablesFillPar( Fxch_Man_t* pFxchMan )
+{
+    Fxch_ThData_t ThData[FXCH_THR_MAX];
+    pthread_t WorkerThread[FXCH_THR_MAX];
+    Vec_Ptr_t* vMatches;
+    int i, status,
+        nProcs = Abc_MinInt( pFxchMan->nProcs, FXCH_THR_MAX );
+
+    if ( nProcs < 2 )
+        return NULL;
+
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pFxchMan  = pFxchMan;
+        ThData[i].iThread   = i;
+        ThData[i].nProcs    = nProcs;
+        ThData[i].vSubCube0 = Vec_IntAlloc( 16 );
+        ThData[i].vSubCube1 = Vec_IntAlloc( 16 );
+        ThData[i].vMatches  = Vec_IntAlloc( 1000 );
+        status = pthread_create( WorkerThread + i, NULL, Fxch_ManSCHashTablesWorkerThread, (void*)(ThData + i) );
+        assert( status == 0 );
+    }
+
+    vMatches = Vec_PtrAlloc( nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        Vec_IntFree( ThData[i].vSubCube0 );
+        Vec_IntFree( ThData[i].vSubCube1 );
+        Vec_PtrPush( vMatches, ThData[i].vMatches );
+    }
+    return vMatches;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
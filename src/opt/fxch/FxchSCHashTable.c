@@ -121,10 +121,12 @@ static inline Fxch_SCHashTable_Entry_t* Fxch_SCHashTableBin( Fxch_SCHashTable_t*
     return pSCHashTable->pBins + (SubCubeID & pSCHashTable->SizeMask);
 }
 
-static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable,
-                                                Vec_Wec_t* vCubes,
-                                                Fxch_SubCube_t* pSCData0,
-                                                Fxch_SubCube_t* pSCData1 )
+static inline int Fxch_SCHashTableEntryCompareInt( Fxch_SCHashTable_t* pSCHashTable,
+                                                   Vec_Wec_t* vCubes,
+                                                   Vec_Int_t* vSubCube0,
+                                                   Vec_Int_t* vSubCube1,
+                                                   Fxch_SubCube_t* pSCData0,
+                                                   Fxch_SubCube_t* pSCData1 )
 {
     Vec_Int_t* vCube0 = Vec_WecEntry( vCubes, pSCData0->iCube ),
              * vCube1 = Vec_WecEntry( vCubes, pSCData1->iCube );
@@ -145,8 +147,8 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
     if ( Result == 0 )
         return 0;
 
-    Vec_IntClear( &pSCHashTable->vSubCube0 );
-    Vec_IntClear( &pSCHashTable->vSubCube1 );
+    Vec_IntClear( vSubCube0 );
+    Vec_IntClear( vSubCube1 );
 
     if ( pSCData0->iLit1 > 0 && pSCData1->iLit1 > 0 &&
          ( Vec_IntEntry( vCube0, pSCData0->iLit0 ) == Vec_IntEntry( vCube1, pSCData1->iLit0 ) ||
@@ -156,43 +158,52 @@ static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable
         return 0;
 
     if ( pSCData0->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube0, vCube0, pSCData0->iLit0 );
+        Vec_IntAppendSkip( vSubCube0, vCube0, pSCData0->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube0, vCube0 );
+        Vec_IntAppend( vSubCube0, vCube0 );
 
     if ( pSCData1->iLit0 > 0 )
-        Vec_IntAppendSkip( &pSCHashTable->vSubCube1, vCube1, pSCData1->iLit0 );
+        Vec_IntAppendSkip( vSubCube1, vCube1, pSCData1->iLit0 );
     else
-        Vec_IntAppend( &pSCHashTable->vSubCube1, vCube1 );
+        Vec_IntAppend( vSubCube1, vCube1 );
 
     if ( pSCData0->iLit1 > 0)
-        Vec_IntDrop( &pSCHashTable->vSubCube0,
+        Vec_IntDrop( vSubCube0,
                        pSCData0->iLit0 < pSCData0->iLit1 ? pSCData0->iLit1 - 1 : pSCData0->iLit1 );
 
     if ( pSCData1->iLit1 > 0 )
-        Vec_IntDrop( &pSCHashTable->vSubCube1,
+        Vec_IntDrop( vSubCube1,
                        pSCData1->iLit0 < pSCData1->iLit1 ? pSCData1->iLit1 - 1 : pSCData1->iLit1 );
 
-    return Vec_IntEqual( &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1 );
+    return Vec_IntEqual( vSubCube0, vSubCube1 );
 }
 
-int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
-                            Vec_Wec_t* vCubes,
-                            uint32_t SubCubeID,
-                            uint32_t iCube,
-                            uint32_t iLit0,
-                            uint32_t iLit1,
-                            char fUpdate )
+static inline int Fxch_SCHashTableEntryCompare( Fxch_SCHashTable_t* pSCHashTable,
+                                                Vec_Wec_t* vCubes,
+                                                Fxch_SubCube_t* pSCData0,
+                                                Fxch_SubCube_t* pSCData1 )
 {
-    int iNewEntry;
-    int Pairs = 0;
-    uint32_t BinID;
-    Fxch_SCHashTable_Entry_t* pBin;
-    Fxch_SubCube_t* pNewEntry;
-    int iEntry;
+    return Fxch_SCHashTableEntryCompareInt( pSCHashTable, vCubes,
+                                            &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1,
+                                            pSCData0, pSCData1 );
+}
 
+static inline unsigned int Fxch_SCHashTableBinIdInt( Fxch_SCHashTable_t* pSCHashTable,
+                                                     uint32_t SubCubeID )
+{
+    uint32_t BinID;
     MurmurHash3_x86_32( ( void* ) &SubCubeID, sizeof( int ), 0x9747b28c, &BinID);
-    pBin = Fxch_SCHashTableBin( pSCHashTable, BinID );
+    return BinID & pSCHashTable->SizeMask;
+}
+
+/* Appends the sub-cube to its bin and returns its index in the bin */
+static inline int Fxch_SCHashTableBinPush( Fxch_SCHashTable_Entry_t* pBin,
+                                           uint32_t SubCubeID,
+                                           uint32_t iCube,
+                                           uint32_t iLit0,
+                                           uint32_t iLit1 )
+{
+    int iNewEntry;
 
     if ( pBin->vSCData == NULL )
     {
@@ -212,6 +223,73 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     pBin->vSCData[iNewEntry].iCube = iCube;
     pBin->vSCData[iNewEntry].iLit0 = iLit0;
     pBin->vSCData[iNewEntry].iLit1 = iLit1;
+    return iNewEntry;
+}
+
+/* Adds the divisor of two matching sub-cubes; returns 1 if a cube pair was added */
+static inline int Fxch_SCHashTableEntryPair( Fxch_SCHashTable_t* pSCHashTable,
+                                             Fxch_SubCube_t* pEntry,
+                                             Fxch_SubCube_t* pNewEntry,
+                                             char fUpdate )
+{
+    int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
+    int Result = 0;
+    int Base;
+    int iNewDiv = -1, i, z;
+
+    if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
+    {
+        Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
+                 * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+
+        if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
+        {
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+        }
+        else
+        {
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
+            Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
+        }
+
+        return 0;
+    }
+
+    Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+
+    if ( Base < 0 )
+        return 0;
+
+    for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
+        Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+
+    for ( z = 0; z < Result; z++ )
+        iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
+
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
+    Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+
+    return 1;
+}
+
+int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
+                            Vec_Wec_t* vCubes,
+                            uint32_t SubCubeID,
+                            uint32_t iCube,
+                            uint32_t iLit0,
+                            uint32_t iLit1,
+                            char fUpdate )
+{
+    int iNewEntry;
+    int Pairs = 0;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry;
+
+    pBin = pSCHashTable->pBins + Fxch_SCHashTableBinIdInt( pSCHashTable, SubCubeID );
+    iNewEntry = Fxch_SCHashTableBinPush( pBin, SubCubeID, iCube, iLit0, iLit1 );
     pSCHashTable->nEntries++;
 
     if ( pBin->Size == 1 )
@@ -221,11 +299,6 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
     for ( iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++ )
     {
         Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
-        int* pOutputID0 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int* pOutputID1 = Vec_IntEntryP( pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID );
-        int Result = 0;
-        int Base;
-        int iNewDiv = -1, i, z;
 
         if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
             continue;
@@ -233,43 +306,101 @@ int Fxch_SCHashTableInsert( Fxch_SCHashTable_t* pSCHashTable,
         if ( !Fxch_SCHashTableEntryCompare( pSCHashTable, vCubes, pEntry, pNewEntry ) )
             continue;
 
-        if ( ( pEntry->iLit0 == 0 ) || ( pNewEntry->iLit0 == 0 ) )
-        {
-            Vec_Int_t* vCube0 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pEntry->iCube ),
-                     * vCube1 = Fxch_ManGetCube( pSCHashTable->pFxchMan, pNewEntry->iCube );
+        Pairs += Fxch_SCHashTableEntryPair( pSCHashTable, pEntry, pNewEntry, fUpdate );
+    }
 
-            if ( Vec_IntSize( vCube0 ) > Vec_IntSize( vCube1 ) )
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-            }
-            else
-            {
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube );
-                Vec_IntPush( pSCHashTable->pFxchMan->vSCC, pEntry->iCube );
-            }
+    return Pairs;
+}
 
-            continue;
-        }
+/**Function*************************************************************
 
-        Base = Fxch_DivCreate( pSCHashTable->pFxchMan, pEntry, pNewEntry );
+  Synopsis    [ Returns the bin of the sub-cube. ]
 
-        if ( Base < 0 )
-            continue;
+  Description []
 
-        for ( i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++ )
-            Result += Fxch_CountOnes( pOutputID0[i] & pOutputID1[i] );
+  SideEffects []
 
-        for ( z = 0; z < Result; z++ )
-            iNewDiv = Fxch_DivAdd( pSCHashTable->pFxchMan, fUpdate, 0, Base );
+  SeeAlso     []
+
+***********************************************************************/
+unsigned int Fxch_SCHashTableBinId( Fxch_SCHashTable_t* pSCHashTable,
+                                    uint32_t SubCubeID )
+{
+    return Fxch_SCHashTableBinIdInt( pSCHashTable, SubCubeID );
+}
 
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube );
-        Vec_WecPush( pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube );
+/**Function*************************************************************
 
-        Pairs++;
+  Synopsis    [ Inserts the sub-cube and collects its matches. ]
+
+  Description [ Works as Fxch_SCHashTableInsert() but, instead of
+                adding the divisors, pushes the quadruple (Seq, BinID,
+                iEntry, iNewEntry) into vMatches for each earlier
+                sub-cube in the bin matching the new one. The manager
+                is only read and the entry counter is not updated, so
+                several threads can run it as long as they insert into
+                different bins, each with its own temporary vectors.
+                The divisors are added later by Fxch_SCHashTablePairAdd(). ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fxch_SCHashTableInsertCollect( Fxch_SCHashTable_t* pSCHashTable,
+                                    Vec_Wec_t* vCubes,
+                                    uint32_t BinID,
+                                    uint32_t SubCubeID,
+                                    uint32_t iCube,
+                                    uint32_t iLit0,
+                                    uint32_t iLit1,
+                                    int Seq,
+                                    Vec_Int_t* vSubCube0,
+                                    Vec_Int_t* vSubCube1,
+                                    Vec_Int_t* vMatches )
+{
+    Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + BinID;
+    int iNewEntry = Fxch_SCHashTableBinPush( pBin, SubCubeID, iCube, iLit0, iLit1 );
+    Fxch_SubCube_t* pNewEntry = &( pBin->vSCData[iNewEntry] );
+    int iEntry;
+
+    for ( iEntry = 0; iEntry < iNewEntry; iEntry++ )
+    {
+        Fxch_SubCube_t* pEntry = &( pBin->vSCData[iEntry] );
+
+        if ( (pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0)  )
+            continue;
+
+        if ( !Fxch_SCHashTableEntryCompareInt( pSCHashTable, vCubes, vSubCube0, vSubCube1, pEntry, pNewEntry ) )
+            continue;
+
+        Vec_IntPush( vMatches, Seq );
+        Vec_IntPush( vMatches, (int)BinID );
+        Vec_IntPush( vMatches, iEntry );
+        Vec_IntPush( vMatches, iNewEntry );
     }
+}
 
-    return Pairs;
+/**Function*************************************************************
+
+  Synopsis    [ Adds the divisor of a match found by Fxch_SCHashTableInsertCollect(). ]
+
+  Description [ Returns 1 if a cube pair was added. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fxch_SCHashTablePairAdd( Fxch_SCHashTable_t* pSCHashTable,
+                             uint32_t BinID,
+                             int iEntry0,
+                             int iEntry1,
+                             char fUpdate )
+{
+    Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + BinID;
+    return Fxch_SCHashTableEntryPair( pSCHashTable, pBin->vSCData + iEntry0,
+                                      pBin->vSCData + iEntry1, fUpdate );
 }
 
 int Fxch_SCHashTableRemove( Fxch_SCHashTable_t* pSCHashTable,
@@ -71,6 +71,7 @@ struct Abs_Par_t_
     int            fDumpMabs;          // dumps the original AIG with abstraction map
     int            fCallProver;        // calls the prover
     int            fSimpProver;        // calls simplification before prover
+    int            nProcs;             // the number of threads running BMC on the abstraction
     char *         pFileVabs;          // dumps the abstracted model into this file
     int            fVerbose;           // verbose flag
     int            fVeryVerbose;       // print additional information
@@ -138,6 +139,9 @@ extern Gia_Man_t *       Gia_ManShrinkGla( Gia_Man_t * p, int nFrameMax, int nTi
 extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose );
 extern void              Gia_GlaProveCancel( int fVerbose );
 extern int               Gia_GlaProveCheck( int fVerbose );
+extern int               Gia_GlaBmcLaunch( Gia_Man_t * p, int nFrames, int nStep, int nProcs, int fVerbose );
+extern void              Gia_GlaBmcCancel( int fVerbose );
+extern int               Gia_GlaBmcCheck( int iFrame );
 /*=== absVta.c =========================================================*/
 extern int               Gia_VtaPerform( Gia_Man_t * pAig, Abs_Par_t * pPars );
 /*=== absUtil.c =========================================================*/
@@ -62,6 +62,8 @@ struct Ga2_Man_t_
     int            nCexes;       // the number of counter-examples
     int            nObjAdded;    // objs added during refinement
     int            nPdrCalls;    // count the number of concurrent calls
+    int            nBmcCalls;    // count the number of concurrent BMC runs
+    int            nBmcFrames;   // count the frames proved by concurrent BMC
     // hash table
     int *          pTable;
     int            nTable;
@@ -469,6 +471,8 @@ void Ga2_ManStop( Ga2_Man_t * p )
     if ( p->pPars->fVerbose )
     Abc_Print( 1, "Hash hits = %d.  Hash misses = %d.  Hash overs = %d.  Concurrent calls = %d.\n", 
         p->nHashHit, p->nHashMiss, p->nHashOver, p->nPdrCalls );
+    if ( p->pPars->fVerbose && p->pPars->nProcs )
+    Abc_Print( 1, "Concurrent BMC runs = %d.  Frames proved by them = %d.\n", p->nBmcCalls, p->nBmcFrames );
 
     if( p->pSat ) sat_solver2_delete( p->pSat );
     Vec_VecFree( (Vec_Vec_t *)p->vCnfs );
@@ -1503,8 +1507,8 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     Ga2_Man_t * p;
     Vec_Int_t * vCore, * vPPis;
     abctime clk2, clk = Abc_Clock();
-    int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0;
-    int i, c, f, Lit;
+    int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0, fProverStarted = 0;
+    int i, c, f, Lit, fProvedBmc;
     pPars->iFrame = -1;
     // check trivial case 
     assert( Gia_ManPoNum(pAig) == 1 ); 
@@ -1527,6 +1531,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
         Vec_IntWriteEntry( pAig->vGateClasses, 0, 1 );
         Vec_IntWriteEntry( pAig->vGateClasses, Gia_ObjFaninId0p(pAig, Gia_ManPo(pAig, 0)), 1 );
     }
+    // forget the frames proved by BMC in the previous runs
+    if ( pPars->nProcs )
+        Gia_GlaBmcCancel( pPars->fVerbose );
     // start the manager
     p = Ga2_ManStart( pAig, pPars );
     p->timeInit = Abc_Clock() - clk;
@@ -1598,6 +1605,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
             Vec_IntFillExtra( Ga2_MapFrameMap(p, f), Vec_IntSize(p->vValues), -1 );
             // add static clauses to this timeframe
             Ga2_ManAddAbsClauses( p, f );
+            // check the current abstraction in the following frames concurrently (&gla -J <num>)
+            if ( pPars->nProcs && Gia_GlaBmcLaunch( pAig, f + 1, 1 + f / 4, pPars->nProcs, pPars->fVeryVerbose ) )
+                p->nBmcCalls++;
             // skip checking if skipcheck is enabled (&gla -s)
             if ( p->pPars->fUseSkip && f <= p->pPars->iFrameProved )
                 continue;
@@ -1612,11 +1622,14 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
             if ( Lit == 0 )
                 continue;
             assert( Lit > 1 );
+            // skip checking if this frame has been proved by concurrent BMC
+            fProvedBmc = pPars->nProcs && Gia_GlaBmcCheck( f );
+            p->nBmcFrames += fProvedBmc;
             // check for counter-examples
             if ( p->nSatVars > sat_solver2_nvars(p->pSat) )
                 sat_solver2_setnvars( p->pSat, p->nSatVars );
             nVarsOld = p->nSatVars;
-            for ( c = 0; ; c++ )
+            for ( c = 0; !fProvedBmc; c++ )
             {
                 // consider the special case when the target literal is implied false
                 // by implications which happened as a result of previous refinements
@@ -1763,6 +1776,8 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                 Vec_IntFree( vCore );
                 break;
             }
+            if ( fProvedBmc && f > p->pPars->iFrameProved )
+                p->pPars->nFramesNoChange++;
             // remember the last proved frame
             if ( p->pPars->iFrameProved < f )
                 p->pPars->iFrameProved = f;
@@ -1788,6 +1803,15 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     Status = l_Undef;
                     goto finish;
                 }
+                // restart the prover on the new abstraction (&gla -q -J <num>)
+                if ( p->pPars->fCallProver && pPars->nProcs && fProverStarted )
+                {
+                    if ( iFrameTryToProve >= 0 )
+                        Gia_GlaProveCancel( pPars->fVerbose );
+                    Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->fVeryVerbose );
+                    iFrameTryToProve = f;
+                    p->nPdrCalls++;
+                }
             }
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
@@ -1813,6 +1837,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->fVeryVerbose );
                     iFrameTryToProve = f;
                     p->nPdrCalls++;
+                    fProverStarted = 1;
                 }
                 // speak to the bridge
                 if ( Abc_FrameIsBridgeMode() )
@@ -1842,6 +1867,9 @@ finish:
     // cancel old one if it is proving
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
+    // cancel BMC on the abstraction
+    if ( pPars->nProcs )
+        Gia_GlaBmcCancel( pPars->fVerbose );
     // analize the results
     if ( !p->fUseNewLine )
         Abc_Print( 1, "\n" );
@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -45,6 +46,9 @@ ABC_NAMESPACE_IMPL_START
 void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
+int  Gia_GlaBmcLaunch( Gia_Man_t * p, int nFrames, int nStep, int nProcs, int fVerbose ) { return 0; }
+void Gia_GlaBmcCancel( int fVerbose )                                      {}
+int  Gia_GlaBmcCheck( int iFrame )                                         { return 0; }
 
 #else // pthreads are used
 
@@ -52,10 +56,20 @@ int  Gia_GlaProveCheck( int fVerbose )                                     { ret
 typedef struct Abs_ThData_t_
 {
     Aig_Man_t * pAig;
+    int         fSimpProver;
     int         fVerbose;
     int         RunId;
 } Abs_ThData_t;
 
+// information given to the BMC thread
+typedef struct Abs_BmcThData_t_
+{
+    Aig_Man_t * pAig;
+    int         nFrames;
+    int         fVerbose;
+    int         RunId;
+} Abs_BmcThData_t;
+
 // mutext to control access to shared variables
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
@@ -64,6 +78,14 @@ static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
 
+// shared variables of the BMC threads (protected by the same mutex)
+static volatile int g_nBmcRunIds  = 0;         // the number of the last BMC run
+static volatile int g_nBmcThreads = 0;         // the number of BMC threads still running
+static Vec_Int_t *  g_vBmcProved  = NULL;      // the timeframes proved by BMC in the last run
+
+// call back procedure for BMC
+int Abs_BmcCallBackToStop( int RunId ) { assert( RunId <= g_nBmcRunIds ); return RunId < g_nBmcRunIds; }
+
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 {
@@ -96,7 +118,17 @@ void * Abs_ProverThread( void * pArg )
 {
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
     Pdr_Par_t Pars, * pPars = &Pars;
+    Ssw_Pars_t ParsSsw, * pParsSsw = &ParsSsw;
+    Aig_Man_t * pTemp;
     int RetValue, status;
+    // simplify abstraction
+    if ( pThData->fSimpProver )
+    {
+        Ssw_ManSetDefaultParams( pParsSsw );
+        pParsSsw->nFramesK = 4;
+        pThData->pAig = Ssw_SignalCorrespondence( pTemp = pThData->pAig, pParsSsw );
+        Aig_ManStop( pTemp );
+    }
     // call PDR
     Pdr_ManSetDefaultParams( pPars );
     pPars->fSilent   = 1;
@@ -133,8 +165,7 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
 {
     extern Aig_Man_t * Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
     Abs_ThData_t * pThData;
-    Ssw_Pars_t Pars, * pPars = &Pars;
-    Aig_Man_t * pAig, * pTemp;
+    Aig_Man_t * pAig;
     Gia_Man_t * pAbs;
     pthread_t ProverThread;
     int status;
@@ -146,17 +177,6 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     Gia_ManCleanValue( pGia );
     pAig = Gia_ManToAigSimple( pAbs );
     Gia_ManStop( pAbs );
-    // simplify abstraction
-    if ( fSimpProver )
-    {
-        Ssw_ManSetDefaultParams( pPars );
-        pPars->nFramesK = 4;
-        pAig = Ssw_SignalCorrespondence( pTemp = pAig, pPars );
-//printf( "\n" );
-//Aig_ManPrintStats( pTemp );
-//Aig_ManPrintStats( pAig );
-        Aig_ManStop( pTemp );
-    }
     // synthesize abstraction
 //    pAig = Dar_ManRwsat( pTemp = pAig, 0, 0 ); 
 //    Aig_ManStop( pTemp );
@@ -167,6 +187,7 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     // collect thread data
     pThData = ABC_CALLOC( Abs_ThData_t, 1 );
     pThData->pAig = pAig;
+    pThData->fSimpProver = fSimpProver;
     pThData->fVerbose = fVerbose;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     pThData->RunId = ++g_nRunIds;
@@ -194,6 +215,114 @@ int Gia_GlaProveCheck( int fVerbose )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs BMC on the current abstraction.]
+
+  Description [Each thread unrolls its own copy of the abstracted model
+  to a different depth. When a thread finishes or is cancelled, the
+  timeframes it has proved are recorded, unless the run has been
+  cancelled by Gia_GlaBmcCancel(), which also frees the record. Since refinement only adds objects
+  to the abstraction, the frames proved for an earlier abstraction
+  remain proved for the later ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abs_BmcThread( void * pArg )
+{
+    Abs_BmcThData_t * pThData = (Abs_BmcThData_t *)pArg;
+    Saig_ParBmc_t Pars, * pPars = &Pars;
+    int RetValue, status, f;
+    // call BMC
+    Saig_ParBmcSetDefaultParams( pPars );
+    pPars->nFramesMax = pThData->nFrames;
+    pPars->fSilent    = 1;
+    pPars->RunId      = pThData->RunId;
+    pPars->pFuncStop  = Abs_BmcCallBackToStop;
+    RetValue = Saig_ManBmcScalable( pThData->pAig, pPars );
+    // record the proved timeframes
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( pThData->RunId == g_nBmcRunIds )
+        for ( f = 0; f <= pPars->iFrame; f++ )
+            Vec_IntSetEntry( g_vBmcProved, f, 1 );
+    g_nBmcThreads--;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    if ( pThData->fVerbose )
+        Abc_Print( 1, "BMC of abstraction up to frame %d %s frame %d.\n", pThData->nFrames - 1, 
+            RetValue == 0 ? "found a counter-example in" : "proved up to", RetValue == 0 ? pPars->iFrame + 1 : pPars->iFrame );
+    // free memory
+    Aig_ManStop( pThData->pAig );
+    ABC_FREE( pThData );
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+int Gia_GlaBmcLaunch( Gia_Man_t * pGia, int nFrames, int nStep, int nProcs, int fVerbose )
+{
+    Abs_BmcThData_t * pThData;
+    Aig_Man_t * pAig;
+    Gia_Man_t * pAbs;
+    pthread_t BmcThread;
+    int i, status, RunId;
+    // wait until the previous threads are done
+    if ( g_nBmcThreads > 0 )
+        return 0;
+    // create abstraction 
+    assert( pGia->vGateClasses != NULL );
+    pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
+    Gia_ManCleanValue( pGia );
+    pAig = Gia_ManToAigSimple( pAbs );
+    Gia_ManStop( pAbs );
+    // BMC needs a sequential model
+    if ( Aig_ManRegNum(pAig) == 0 )
+    {
+        Aig_ManStop( pAig );
+        return 0;
+    }
+    // start the run
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( g_vBmcProved == NULL )
+        g_vBmcProved = Vec_IntAlloc( 100 );
+    g_nBmcThreads += nProcs;
+    RunId = g_nBmcRunIds;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    // create threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData = ABC_CALLOC( Abs_BmcThData_t, 1 );
+        pThData->pAig     = i ? Aig_ManDupSimple( pAig ) : pAig;
+        pThData->nFrames  = nFrames + (i + 1) * nStep;
+        pThData->fVerbose = fVerbose;
+        pThData->RunId    = RunId;
+        status = pthread_create( &BmcThread, NULL, Abs_BmcThread, pThData );
+        assert( status == 0 );
+        status = pthread_detach( BmcThread );
+        assert( status == 0 );
+    }
+    return 1;
+}
+void Gia_GlaBmcCancel( int fVerbose )
+{
+    int status;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    g_nBmcRunIds++;
+    Vec_IntFreeP( &g_vBmcProved );
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
+int Gia_GlaBmcCheck( int iFrame )
+{
+    int status, RetValue = 0;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( g_vBmcProved && iFrame < Vec_IntSize(g_vBmcProved) )
+        RetValue = Vec_IntEntry( g_vBmcProved, iFrame );
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    return RetValue;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
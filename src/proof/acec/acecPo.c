@@ -22,12 +22,79 @@
 #include "misc/vec/vecWec.h"
 #include "misc/vec/vecHsh.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define ACEC_THR_MAX       64       // the max number of threads
+#define ACEC_PAR_MIN     1000       // the min number of monomials rewritten on several threads
+#define ACEC_COMPACT_MIN 100000     // the min number of dead monomials triggering compaction
+
+// one part of the monomial table
+typedef struct Gia_PolynShard_t_ Gia_PolynShard_t;
+struct Gia_PolynShard_t_
+{
+    Hsh_VecMan_t *     pHashC;      // hash table for constants
+    Hsh_VecMan_t *     pHashM;      // hash table for monomials
+    Vec_Int_t *        vCoefs;      // monomial coefficients
+    Vec_Int_t *        vNew;        // monomials created while rewriting the current node
+    Vec_Int_t *        vMap;        // mapping of monomials during compaction
+    Vec_Int_t *        vTempC;      // temporary constant
+    int                nLive;       // the change in the number of live monomials
+    int                nTerms;      // the number of added terms
+};
+
+// information given to the thread
+typedef struct Gia_PolynThData_t_ Gia_PolynThData_t;
+struct Gia_PolynThData_t_
+{
+    struct Gia_PolynPar_t_ * p;     // the shared data
+    Vec_Int_t *        vTerms[ACEC_THR_MAX]; // the terms derived by this thread for each shard
+    Vec_Int_t *        vTempC[4];   // temporary constants
+    Vec_Int_t *        vTempM[4];   // temporary monomials
+    int                iThread;     // the number of this thread
+    int                nKilled;     // the number of rewritten monomials
+};
+
+// parallel backward rewriting
+typedef struct Gia_PolynPar_t_ Gia_PolynPar_t;
+struct Gia_PolynPar_t_
+{
+    Gia_Man_t *        pGia;        // AIG manager
+    int                nProcs;      // the number of threads and shards
+    int                fStarted;    // the threads are started
+    int                Phase;       // the task given to the threads
+    int                iRound;      // the number of tasks given to the threads
+    int                nBusy;       // the number of threads performing the current task
+    int                fStop;       // the threads should exit
+    int                iObj;        // the node being rewritten
+    Vec_Int_t *        vMonos;      // the monomials containing this node
+    Vec_Wec_t *        vLit2Mono;   // mapping objects into monomials
+    int                nLive;       // the number of live monomials
+    int                nCompacts;   // the number of compactions
+    Gia_PolynShard_t   Shards[ACEC_THR_MAX];
+    Gia_PolynThData_t  ThData[ACEC_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t    Mutex;       // protects the task counters
+    pthread_cond_t     CondStart;   // signals a new task or the stop
+    pthread_cond_t     CondDone;    // signals that the last thread is done
+    pthread_t          WorkerThread[ACEC_THR_MAX];
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -636,7 +703,456 @@ static inline void Gia_PolynPrepare4( Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[
     Vec_IntPushUniqueOrder( vTempM[3], iFan1 );
 }
 
-Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int fVerbose, int fVeryVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Parallel backward rewriting.]
+
+  Description [The monomials are divided among the shards by their hash
+  value. Each shard has its own tables of monomials and constants, and the
+  monomial number is the shard number plus the number of shards times the
+  number of the monomial in its shard. Each node is rewritten in two phases.
+  First, the threads divide the live monomials containing the node and
+  derive the new terms, which are stored separately for each shard.
+  Second, each thread adds the terms of its shard, taking the terms of all
+  threads in a fixed order. The result depends on the number of threads
+  but not on the timing of the threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_PolynReadView( Hsh_VecMan_t * p, int i, Vec_Int_t * vView )
+{
+    Hsh_VecObj_t * pObj = Hsh_VecObj( p, i );
+    vView->nSize  = vView->nCap = pObj->nSize;
+    vView->pArray = pObj->pArray;
+}
+static inline void Gia_PolynParPushTerm( Gia_PolynThData_t * pThData, Vec_Int_t * vConst, Vec_Int_t * vMono )
+{
+    Vec_Int_t * vTerms = pThData->vTerms[Hsh_VecManHash(vMono, pThData->p->nProcs)];
+    Vec_IntPush( vTerms, Vec_IntSize(vConst) );
+    Vec_IntAppend( vTerms, vConst );
+    Vec_IntPush( vTerms, Vec_IntSize(vMono) );
+    Vec_IntAppend( vTerms, vMono );
+}
+void Gia_PolynParRewrite( Gia_PolynPar_t * p, int iThread )
+{
+    Gia_PolynThData_t * pThData = p->ThData + iThread;
+    Vec_Int_t ** vTempC = pThData->vTempC, ** vTempM = pThData->vTempM;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, p->iObj );
+    Vec_Int_t vConst, vMono;
+    int nChunk = (Vec_IntSize(p->vMonos) + p->nProcs - 1) / p->nProcs;
+    int iStop  = Abc_MinInt( (iThread + 1) * nChunk, Vec_IntSize(p->vMonos) );
+    int i, iMono, iConst;
+    for ( i = iThread * nChunk; i < iStop; i++ )
+    {
+        Gia_PolynShard_t * pShard;
+        iMono  = Vec_IntEntry( p->vMonos, i );
+        pShard = p->Shards + iMono % p->nProcs;
+        iMono /= p->nProcs;
+        if ( (iConst = Vec_IntEntry(pShard->vCoefs, iMono)) == 0 )
+            continue;
+        Gia_PolynReadView( pShard->pHashC, iConst, &vConst );
+        Gia_PolynReadView( pShard->pHashM, iMono, &vMono );
+        Gia_PolynPrepare4( vTempC, vTempM, &vConst, &vMono, p->iObj, Gia_ObjFaninId0(pObj, p->iObj), Gia_ObjFaninId1(pObj, p->iObj) );
+        if ( Gia_ObjIsXor(pObj) )
+        {
+        }
+        else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )  //  C * (1 - x) * (1 - y)
+        {
+            Gia_PolynParPushTerm( pThData, vTempC[0], vTempM[0] );   //  C * 1
+            Gia_PolynParPushTerm( pThData, vTempC[1], vTempM[1] );   // -C * x
+            Gia_PolynParPushTerm( pThData, vTempC[3], vTempM[2] );   // -C * y 
+            Gia_PolynParPushTerm( pThData, vTempC[2], vTempM[3] );   //  C * x * y
+        }
+        else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) ) //  C * (1 - x) * y
+        {
+            Gia_PolynParPushTerm( pThData, vTempC[0], vTempM[2] );   //  C * y 
+            Gia_PolynParPushTerm( pThData, vTempC[1], vTempM[3] );   // -C * x * y
+        }
+        else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) ) //  C * x * (1 - y)
+        {
+            Gia_PolynParPushTerm( pThData, vTempC[0], vTempM[1] );   //  C * x 
+            Gia_PolynParPushTerm( pThData, vTempC[1], vTempM[3] );   // -C * x * y
+        }
+        else   
+            Gia_PolynParPushTerm( pThData, vTempC[0], vTempM[3] );   //  C * x * y
+        // different threads clear different entries
+        Vec_IntWriteEntry( pShard->vCoefs, iMono, 0 );
+        pThData->nKilled++;
+    }
+}
+void Gia_PolynParAddTerms( Gia_PolynPar_t * p, int iShard )
+{
+    Gia_PolynShard_t * pShard = p->Shards + iShard;
+    Vec_Int_t * vTerms, vMono;
+    int t, k, nSize, iMono, iConst, iConstNew;
+    for ( t = 0; t < p->nProcs; t++ )
+    {
+        vTerms = p->ThData[t].vTerms[iShard];
+        for ( k = 0; k < Vec_IntSize(vTerms); k += nSize + 1 )
+        {
+            nSize = Vec_IntEntry( vTerms, k );
+            Vec_IntClear( pShard->vTempC );
+            Vec_IntPushArray( pShard->vTempC, Vec_IntArray(vTerms) + k + 1, nSize );
+            k += nSize + 1;
+            nSize = Vec_IntEntry( vTerms, k );
+            vMono.nSize  = vMono.nCap = nSize;
+            vMono.pArray = Vec_IntArray(vTerms) + k + 1;
+            pShard->nTerms++;
+            // the same as Gia_PolynBuildAdd() but the new monomials are recorded
+            iMono = Hsh_VecManAdd( pShard->pHashM, &vMono );
+            if ( iMono == Vec_IntSize(pShard->vCoefs) ) // new monomial
+            {
+                assert( Vec_IntSize(pShard->vTempC) > 0 );
+                Vec_IntPush( pShard->vCoefs, Hsh_VecManAdd(pShard->pHashC, pShard->vTempC) );
+                Vec_IntPush( pShard->vNew, iMono );
+                pShard->nLive++;
+                continue;
+            }
+            // this monomial exists
+            iConst = Vec_IntEntry( pShard->vCoefs, iMono );
+            if ( iConst )
+                Gia_PolynMergeConst( pShard->vTempC, pShard->pHashC, iConst );
+            iConstNew = Hsh_VecManAdd( pShard->pHashC, pShard->vTempC );
+            Vec_IntWriteEntry( pShard->vCoefs, iMono, iConstNew );
+            pShard->nLive += (!iConst && iConstNew) - (iConst && !iConstNew);
+        }
+        Vec_IntClear( vTerms );
+    }
+}
+void Gia_PolynParCompactShard( Gia_PolynPar_t * p, int iShard )
+{
+    Gia_PolynShard_t * pShard = p->Shards + iShard;
+    Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );
+    Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );
+    Vec_Int_t * vCoefs = Vec_IntAlloc( 1000 );
+    int iConst, iMono;
+    // add 0-constant
+    Vec_IntClear( pShard->vTempC );
+    Hsh_VecManAdd( pHashC, pShard->vTempC );
+    // copy the live monomials
+    Vec_IntFill( pShard->vMap, Vec_IntSize(pShard->vCoefs), -1 );
+    Vec_IntForEachEntry( pShard->vCoefs, iConst, iMono )
+    {
+        if ( iConst == 0 )
+            continue;
+        Vec_IntWriteEntry( pShard->vMap, iMono, Vec_IntSize(vCoefs) );
+        Hsh_VecManAdd( pHashM, Hsh_VecReadEntry(pShard->pHashM, iMono) );
+        Vec_IntPush( vCoefs, Hsh_VecManAdd(pHashC, Hsh_VecReadEntry(pShard->pHashC, iConst)) );
+    }
+    Hsh_VecManStop( pShard->pHashC );
+    Hsh_VecManStop( pShard->pHashM );
+    Vec_IntFree( pShard->vCoefs );
+    pShard->pHashC = pHashC;
+    pShard->pHashM = pHashM;
+    pShard->vCoefs = vCoefs;
+}
+void Gia_PolynParPerform( Gia_PolynPar_t * p, int iThread, int Phase )
+{
+    if ( Phase == 1 )
+        Gia_PolynParRewrite( p, iThread );
+    else if ( Phase == 2 )
+        Gia_PolynParAddTerms( p, iThread );
+    else if ( Phase == 3 )
+        Gia_PolynParCompactShard( p, iThread );
+    else assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one phase on all threads.]
+
+  Description [Small tasks are performed by the calling thread, which
+  gives the same result. Between the tasks, the threads wait on the
+  condition variable.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Gia_PolynParWorkerThread( void * pArg )
+{
+    Gia_PolynThData_t * pThData = (Gia_PolynThData_t *)pArg;
+    Gia_PolynPar_t * p = pThData->p;
+    int iRound = 0, Phase;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->iRound == iRound && !p->fStop )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        iRound = p->iRound;
+        Phase  = p->fStop ? 0 : p->Phase;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( Phase == 0 )
+            return NULL;
+        Gia_PolynParPerform( p, pThData->iThread, Phase );
+        pthread_mutex_lock( &p->Mutex );
+        if ( --p->nBusy == 0 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    assert( 0 );
+    return NULL;
+}
+#endif
+void Gia_PolynParRunPhase( Gia_PolynPar_t * p, int Phase, int fThreads )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    if ( fThreads && p->nProcs > 1 )
+    {
+        int status;
+        if ( !p->fStarted )
+        {
+            status = pthread_mutex_init( &p->Mutex, NULL );        assert( status == 0 );
+            status = pthread_cond_init( &p->CondStart, NULL );     assert( status == 0 );
+            status = pthread_cond_init( &p->CondDone, NULL );      assert( status == 0 );
+            for ( i = 1; i < p->nProcs; i++ )
+            {
+                status = pthread_create( p->WorkerThread + i, NULL, Gia_PolynParWorkerThread, (void *)(p->ThData + i) );
+                assert( status == 0 );
+            }
+            p->fStarted = 1;
+        }
+        // give the task to the threads
+        pthread_mutex_lock( &p->Mutex );
+        assert( p->nBusy == 0 );
+        p->Phase = Phase;
+        p->nBusy = p->nProcs - 1;
+        p->iRound++;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        // perform the first part here
+        Gia_PolynParPerform( p, 0, Phase );
+        // wait till the threads finish
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nBusy > 0 )
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
+        pthread_mutex_unlock( &p->Mutex );
+        return;
+    }
+#endif
+    for ( i = 0; i < p->nProcs; i++ )
+        Gia_PolynParPerform( p, i, Phase );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the new monomials in the lists of their objects.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_PolynParUpdate( Gia_PolynPar_t * p )
+{
+    Vec_Int_t * vMono;
+    int s, i, k, iMono, iObj;
+    for ( s = 0; s < p->nProcs; s++ )
+    {
+        Gia_PolynShard_t * pShard = p->Shards + s;
+        Vec_IntForEachEntry( pShard->vNew, iMono, i )
+        {
+            vMono = Hsh_VecReadEntry( pShard->pHashM, iMono );
+            Vec_IntForEachEntry( vMono, iObj, k )
+                Vec_WecPush( p->vLit2Mono, iObj, s + p->nProcs * iMono );
+        }
+        Vec_IntClear( pShard->vNew );
+        p->nLive += pShard->nLive;
+        pShard->nLive = 0;
+    }
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->nLive -= p->ThData[i].nKilled;
+        p->ThData[i].nKilled = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the dead monomials.]
+
+  Description [The monomials whose coefficients are zero stay in the hash
+  tables and in the lists of the objects. When they outnumber the live
+  monomials, the tables are rebuilt and the lists are renumbered.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_PolynParCompact( Gia_PolynPar_t * p )
+{
+    Vec_Int_t * vLevel;
+    int i, k, j, iMono, iMonoNew, nStored = 0;
+    for ( i = 0; i < p->nProcs; i++ )
+        nStored += Vec_IntSize( p->Shards[i].vCoefs );
+    if ( nStored < 2 * p->nLive + ACEC_COMPACT_MIN )
+        return;
+    Gia_PolynParRunPhase( p, 3, 1 );
+    Vec_WecForEachLevel( p->vLit2Mono, vLevel, i )
+    {
+        j = 0;
+        Vec_IntForEachEntry( vLevel, iMono, k )
+        {
+            iMonoNew = Vec_IntEntry( p->Shards[iMono % p->nProcs].vMap, iMono / p->nProcs );
+            if ( iMonoNew >= 0 )
+                Vec_IntWriteEntry( vLevel, j++, iMono % p->nProcs + p->nProcs * iMonoNew );
+        }
+        Vec_IntShrink( vLevel, j );
+    }
+    p->nCompacts++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the polynomial using several threads.]
+
+  Description [Takes the polynomial in terms of the outputs given by the
+  three tables and returns the polynomial in terms of the inputs in the
+  new tables. Returns the number of added terms.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PolynBuildPar( Gia_Man_t * pGia, Vec_Int_t * vNodes, Hsh_VecMan_t ** ppHashC, Hsh_VecMan_t ** ppHashM, Vec_Int_t ** pvCoefs, int nProcs, int fVerbose )
+{
+    Gia_PolynPar_t * p = ABC_CALLOC( Gia_PolynPar_t, 1 );
+    Hsh_VecMan_t * pHashC, * pHashM;
+    Vec_Int_t * vCoefs, * vTempC = Vec_IntAlloc( 10 );
+    int i, k, iObj, iMono, iConst, iMonoNew, nTerms = 0;
+    p->pGia      = pGia;
+    p->nProcs    = Abc_MinInt( nProcs, ACEC_THR_MAX );
+    p->vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Gia_PolynShard_t * pShard = p->Shards + i;
+        pShard->pHashC = Hsh_VecManStart( 1000 );
+        pShard->pHashM = Hsh_VecManStart( 1000 );
+        pShard->vCoefs = Vec_IntAlloc( 1000 );
+        pShard->vNew   = Vec_IntAlloc( 1000 );
+        pShard->vMap   = Vec_IntAlloc( 1000 );
+        pShard->vTempC = Vec_IntAlloc( 10 );
+        // add 0-constant
+        Hsh_VecManAdd( pShard->pHashC, vTempC );
+        p->ThData[i].p       = p;
+        p->ThData[i].iThread = i;
+        for ( k = 0; k < p->nProcs; k++ )
+            p->ThData[i].vTerms[k] = Vec_IntAlloc( 100 );
+        for ( k = 0; k < 4; k++ )
+            p->ThData[i].vTempC[k] = Vec_IntAlloc( 10 );
+        for ( k = 0; k < 4; k++ )
+            p->ThData[i].vTempM[k] = Vec_IntAlloc( 10 );
+    }
+    // distribute the live monomials among the shards
+    Vec_IntForEachEntry( *pvCoefs, iConst, iMono )
+        if ( iConst )
+            Gia_PolynParPushTerm( p->ThData, Hsh_VecReadEntry(*ppHashC, iConst), Hsh_VecReadEntry1(*ppHashM, iMono) );
+    Gia_PolynParRunPhase( p, 2, 0 );
+    Gia_PolynParUpdate( p );
+    // perform construction for internal nodes
+    Vec_IntForEachEntryReverse( vNodes, iObj, i )
+    {
+        int fThreads;
+        p->iObj   = iObj;
+        p->vMonos = Vec_WecEntry( p->vLit2Mono, iObj );
+        fThreads  = Vec_IntSize(p->vMonos) >= ACEC_PAR_MIN;
+        Gia_PolynParRunPhase( p, 1, fThreads );
+        Gia_PolynParRunPhase( p, 2, fThreads );
+        Gia_PolynParUpdate( p );
+        // this object does not appear in the new monomials
+        Vec_IntErase( p->vMonos );
+        Gia_PolynParCompact( p );
+    }
+    // stop the threads
+#ifdef ABC_USE_PTHREADS
+    if ( p->fStarted )
+    {
+        int status;
+        pthread_mutex_lock( &p->Mutex );
+        assert( p->nBusy == 0 );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        for ( i = 1; i < p->nProcs; i++ )
+        {
+            status = pthread_join( p->WorkerThread[i], NULL );
+            assert( status == 0 );
+        }
+        pthread_cond_destroy( &p->CondStart );
+        pthread_cond_destroy( &p->CondDone );
+        pthread_mutex_destroy( &p->Mutex );
+    }
+#endif
+    // collect the resulting polynomial
+    pHashC = Hsh_VecManStart( 1000 );
+    pHashM = Hsh_VecManStart( 1000 );
+    vCoefs = Vec_IntAlloc( 1000 );
+    Vec_IntClear( vTempC );
+    Hsh_VecManAdd( pHashC, vTempC );
+    Hsh_VecManAdd( pHashM, vTempC );
+    Vec_IntPush( vCoefs, 0 );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Gia_PolynShard_t * pShard = p->Shards + i;
+        Vec_IntForEachEntry( pShard->vCoefs, iConst, iMono )
+        {
+            if ( iConst == 0 )
+                continue;
+            iMonoNew = Hsh_VecManAdd( pHashM, Hsh_VecReadEntry(pShard->pHashM, iMono) );
+            if ( iMonoNew == Vec_IntSize(vCoefs) )
+                Vec_IntPush( vCoefs, 0 );
+            Vec_IntWriteEntry( vCoefs, iMonoNew, Hsh_VecManAdd(pHashC, Hsh_VecReadEntry(pShard->pHashC, iConst)) );
+        }
+        nTerms += pShard->nTerms;
+        Hsh_VecManStop( pShard->pHashC );
+        Hsh_VecManStop( pShard->pHashM );
+        Vec_IntFree( pShard->vCoefs );
+        Vec_IntFree( pShard->vNew );
+        Vec_IntFree( pShard->vMap );
+        Vec_IntFree( pShard->vTempC );
+        for ( k = 0; k < p->nProcs; k++ )
+            Vec_IntFree( p->ThData[i].vTerms[k] );
+        for ( k = 0; k < 4; k++ )
+            Vec_IntFree( p->ThData[i].vTempC[k] );
+        for ( k = 0; k < 4; k++ )
+            Vec_IntFree( p->ThData[i].vTempM[k] );
+    }
+    if ( fVerbose )
+        printf( "Rewriting used %d threads and performed %d compactions of the monomial tables.\n", p->nProcs, p->nCompacts );
+    Hsh_VecManStop( *ppHashC );
+    Hsh_VecManStop( *ppHashM );
+    Vec_IntFree( *pvCoefs );
+    *ppHashC = pHashC;
+    *ppHashM = pHashM;
+    *pvCoefs = vCoefs;
+    Vec_WecFree( p->vLit2Mono );
+    Vec_IntFree( vTempC );
+    ABC_FREE( p );
+    return nTerms;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the input signature by backward rewriting.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int nProcs, int fVerbose, int fVeryVerbose )
 {
     abctime clk = Abc_Clock();
     Vec_Wec_t * vPolyn;
@@ -730,6 +1246,12 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
     }
 
     // perform construction for internal nodes
+    if ( nProcs > 1 )
+    {
+        nBuilds += Gia_PolynBuildPar( pGia, vNodes, &pHashC, &pHashM, &vCoefs, nProcs, fVerbose );
+        nMonos = Vec_IntSize(vCoefs) - Vec_IntCountZero(vCoefs);
+    }
+    else
     Vec_IntForEachEntryReverse( vNodes, iObj, i )
     {
         Gia_Obj_t * pObj = Gia_ManObj( pGia, iObj );
@@ -801,7 +1323,7 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigned, int fVerbose, int fVeryVerbose )
+void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigned, int nProcs, int fVerbose, int fVeryVerbose )
 {
     Vec_Wec_t * vPolyn;
     Vec_Int_t * vRootLits = Vec_IntAlloc( Gia_ManCoNum(pGia) );
@@ -842,7 +1364,7 @@ void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigne
         else if ( Gia_ObjIsCo(pObj) )
             Vec_IntPush( vRootLits, Gia_ObjFaninLit0p(pGia, pObj) );
 
-    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, fVerbose, fVeryVerbose );
+    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, nProcs, fVerbose, fVeryVerbose );
     //printf( "Polynomial has %d monomials.\n", Vec_WecSize(vPolyn)/2 );
     if ( fVerbose || fVeryVerbose )
         Gia_PolynPrintStats( vPolyn );
@@ -59,6 +59,7 @@ struct Dch_Man_t_
     // equivalence classes
     Dch_Cla_t *      ppClasses;      // equivalence classes of nodes
     Aig_Obj_t **     pReprsProved;   // equivalences proved
+    int *            pParReprs;      // equivalences proved by concurrent threads
     // SAT solving
     sat_solver *     pSat;           // recyclable SAT solver
     int              nSatVars;       // the counter of SAT variables
@@ -78,6 +79,9 @@ struct Dch_Man_t_
     int              nSatFailsReal;  // the number of timeouts
     int              nSatCallsUnsat; // the number of unsat SAT calls
     int              nSatCallsSat;   // the number of sat SAT calls
+    int              nParCalls;      // the number of concurrent SAT calls
+    int              nParProved;     // the number of concurrent proofs
+    int              nParUsed;       // the number of concurrent proofs used
     // choice node statistics
     int              nLits;          // the number of lits in the cand equiv classes
     int              nReprs;         // the number of proved equivalent pairs
@@ -90,6 +94,7 @@ struct Dch_Man_t_
     abctime          timeSatSat;     // sat
     abctime          timeSatUnsat;   // unsat
     abctime          timeSatUndec;   // undecided
+    abctime          timeSatPar;     // concurrent SAT solving
     abctime          timeChoice;     // choice computation
     abctime          timeOther;      // other runtime
     abctime          timeTotal;      // total runtime
@@ -146,6 +151,8 @@ extern void          Dch_CnfNodeAddToSolver( Dch_Man_t * p, Aig_Obj_t * pObj );
 extern Dch_Man_t *   Dch_ManCreate( Aig_Man_t * pAig, Dch_Pars_t * pPars );
 extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
+/*=== dchPth.c ===================================================*/
+extern void          Dch_ManSweepPar( Dch_Man_t * p );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
 /*=== dchSim.c ===================================================*/
@@ -0,0 +1,321 @@
+/**CFile****************************************************************
+
+  FileName    [dchPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Concurrent SAT sweeping of candidate equivalence classes.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: dchPth.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void Dch_ManSweepPar( Dch_Man_t * p ) {}
+
+#else // pthreads are used
+
+#define DCH_THR_MAX 100
+
+typedef struct Dch_ThData_t_ Dch_ThData_t;
+struct Dch_ThData_t_
+{
+    Dch_Man_t *      p;              // choicing manager (read-only in the threads)
+    Vec_Int_t *      vPairs;         // candidate pairs (repr, node) of this thread
+    sat_solver *     pSat;           // thread-local SAT solver
+    int *            pSatVars;       // thread-local mapping of nodes into SAT vars
+    Vec_Int_t *      vUsedNodes;     // nodes whose SAT vars are assigned
+    int              nSatVars;       // the counter of SAT variables
+    int              nSatCalls;      // the number of SAT calls
+    int              nSatProof;      // the number of proofs
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Recycles the thread-local SAT solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dch_ThSolverRecycle( Dch_ThData_t * pTh )
+{
+    int i, Id;
+    Vec_IntForEachEntry( pTh->vUsedNodes, Id, i )
+        pTh->pSatVars[Id] = 0;
+    Vec_IntClear( pTh->vUsedNodes );
+    if ( pTh->pSat )
+        sat_solver_delete( pTh->pSat );
+    pTh->pSat = sat_solver_new();
+    sat_solver_setnvars( pTh->pSat, 1000 );
+    // var 0 is not used
+    pTh->nSatVars = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the cone of the node to the thread-local SAT solver.]
+
+  Description [Returns the SAT variable of the node. Only reads the
+  structure of the AIG, so several threads can run it at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dch_ThAddCone_rec( Dch_ThData_t * pTh, Aig_Obj_t * pObj )
+{
+    int pLits[3], iVar, iVar0, iVar1, RetValue;
+    if ( pTh->pSatVars[pObj->Id] )
+        return pTh->pSatVars[pObj->Id];
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        iVar0 = Dch_ThAddCone_rec( pTh, Aig_ObjFanin0(pObj) );
+        iVar1 = Dch_ThAddCone_rec( pTh, Aig_ObjFanin1(pObj) );
+    }
+    iVar = pTh->nSatVars++;
+    pTh->pSatVars[pObj->Id] = iVar;
+    Vec_IntPush( pTh->vUsedNodes, pObj->Id );
+    sat_solver_setnvars( pTh->pSat, pTh->nSatVars );
+    if ( Aig_ObjIsConst1(pObj) )
+    {
+        pLits[0] = toLit( iVar );
+        RetValue = sat_solver_addclause( pTh->pSat, pLits, pLits + 1 );
+        assert( RetValue );
+        return iVar;
+    }
+    if ( !Aig_ObjIsNode(pObj) )
+        return iVar;
+    // f = a & b:  (!f + a) (!f + b) (f + !a + !b)
+    pLits[0] = toLitCond( iVar, 1 );
+    pLits[1] = toLitCond( iVar0, Aig_ObjFaninC0(pObj) );
+    RetValue = sat_solver_addclause( pTh->pSat, pLits, pLits + 2 );
+    assert( RetValue );
+    pLits[1] = toLitCond( iVar1, Aig_ObjFaninC1(pObj) );
+    RetValue = sat_solver_addclause( pTh->pSat, pLits, pLits + 2 );
+    assert( RetValue );
+    pLits[0] = toLitCond( iVar, 0 );
+    pLits[1] = toLitCond( iVar0, !Aig_ObjFaninC0(pObj) );
+    pLits[2] = toLitCond( iVar1, !Aig_ObjFaninC1(pObj) );
+    RetValue = sat_solver_addclause( pTh->pSat, pLits, pLits + 3 );
+    assert( RetValue );
+    return iVar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one SAT problem under assumptions.]
+
+  Description [Returns 1 if UNSAT, 0 if SAT, and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dch_ThSolveOne( Dch_ThData_t * pTh, int * pLits, int nLits )
+{
+    int RetValue;
+    pTh->nSatCalls++;
+    RetValue = sat_solver_solve( pTh->pSat, pLits, pLits + nLits,
+        (ABC_INT64_T)pTh->p->pPars->nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    if ( RetValue == l_True )
+        return 0;
+    if ( RetValue == l_Undef )
+        return -1;
+    // remember the proved implication
+    if ( nLits == 2 )
+    {
+        pLits[0] = lit_neg( pLits[0] );
+        pLits[1] = lit_neg( pLits[1] );
+        RetValue = sat_solver_addclause( pTh->pSat, pLits, pLits + 2 );
+        assert( RetValue );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks equivalence of the node and its representative.]
+
+  Description [Returns 1 if equivalent, 0 if disproved, -1 if undecided.
+  The equivalence is up to the complementation given by the phases.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dch_ThNodesAreEquiv( Dch_ThData_t * pTh, Aig_Obj_t * pRepr, Aig_Obj_t * pObj )
+{
+    int pLits[2], iVarRepr, iVarObj, fCompl, RetValue;
+    // check if SAT solver needs recycling
+    if ( pTh->pSat == NULL ||
+        (pTh->p->pPars->nSatVarMax && pTh->nSatVars > pTh->p->pPars->nSatVarMax) )
+        Dch_ThSolverRecycle( pTh );
+    iVarObj = Dch_ThAddCone_rec( pTh, pObj );
+    // constant candidate: the node is equal to its phase
+    if ( Aig_ObjIsConst1(pRepr) )
+    {
+        pLits[0] = toLitCond( iVarObj, pObj->fPhase );
+        RetValue = Dch_ThSolveOne( pTh, pLits, 1 );
+        pTh->nSatProof += (RetValue == 1);
+        return RetValue;
+    }
+    iVarRepr = Dch_ThAddCone_rec( pTh, pRepr );
+    fCompl = pObj->fPhase ^ pRepr->fPhase;
+    // A = 1; B = 0     OR     A = 1; B = 1
+    pLits[0] = toLitCond( iVarRepr, 0 );
+    pLits[1] = toLitCond( iVarObj, !fCompl );
+    RetValue = Dch_ThSolveOne( pTh, pLits, 2 );
+    if ( RetValue != 1 )
+        return RetValue;
+    // A = 0; B = 1     OR     A = 0; B = 0
+    pLits[0] = toLitCond( iVarRepr, 1 );
+    pLits[1] = toLitCond( iVarObj, fCompl );
+    RetValue = Dch_ThSolveOne( pTh, pLits, 2 );
+    pTh->nSatProof += (RetValue == 1);
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread proving the candidate pairs of its classes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Dch_ManSweepWorkerThread( void * pArg )
+{
+    Dch_ThData_t * pTh = (Dch_ThData_t *)pArg;
+    Aig_Man_t * pAig = pTh->p->pAigTotal;
+    Aig_Obj_t * pRepr, * pObj;
+    int i, iRepr, iObj;
+    Vec_IntForEachEntryDouble( pTh->vPairs, iRepr, iObj, i )
+    {
+        pRepr = Aig_ManObj( pAig, iRepr );
+        pObj  = Aig_ManObj( pAig, iObj );
+        // each node belongs to exactly one thread, so there is no write conflict
+        if ( Dch_ThNodesAreEquiv( pTh, pRepr, pObj ) == 1 )
+            pTh->p->pParReprs[iObj] = iRepr;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves candidate equivalences using concurrent threads.]
+
+  Description [The candidate classes are distributed among the threads
+  by their representatives. Each thread has its own SAT solver loaded
+  with the cones of its classes. The proved pairs are recorded in
+  p->pParReprs and later reused by the sequential sweep, which still
+  handles the disproved and undecided pairs and refines the classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar( Dch_Man_t * p )
+{
+    Dch_ThData_t ThData[DCH_THR_MAX];
+    pthread_t WorkerThread[DCH_THR_MAX];
+    Aig_Obj_t * pObj, * pRepr;
+    int i, status, nProcs = Abc_MinInt( p->pPars->nProcs, DCH_THR_MAX );
+    abctime clk = Abc_Clock();
+    if ( nProcs < 2 )
+        return;
+    // distribute the candidate pairs by class
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Dch_ThData_t) );
+        ThData[i].p          = p;
+        ThData[i].vPairs     = Vec_IntAlloc( 1000 );
+        ThData[i].pSatVars   = ABC_CALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+        ThData[i].vUsedNodes = Vec_IntAlloc( 1000 );
+    }
+    Aig_ManForEachNode( p->pAigTotal, pObj, i )
+    {
+        pRepr = Aig_ObjRepr( p->pAigTotal, pObj );
+        if ( pRepr == NULL )
+            continue;
+        Vec_IntPushTwo( ThData[pRepr->Id % nProcs].vPairs, pRepr->Id, pObj->Id );
+    }
+    ABC_FREE( p->pParReprs );
+    p->pParReprs = ABC_FALLOC( int, Aig_ManObjNumMax(p->pAigTotal) );
+    // run the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Dch_ManSweepWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    // collect statistics and cleanup
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->nParCalls  += ThData[i].nSatCalls;
+        p->nParProved += ThData[i].nSatProof;
+        if ( ThData[i].pSat )
+            sat_solver_delete( ThData[i].pSat );
+        Vec_IntFree( ThData[i].vUsedNodes );
+        Vec_IntFree( ThData[i].vPairs );
+        ABC_FREE( ThData[i].pSatVars );
+    }
+    p->timeSatPar = Abc_Clock() - clk;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
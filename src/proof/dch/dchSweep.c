@@ -69,6 +69,15 @@ void Dch_ManSweepNode( Dch_Man_t * p, Aig_Obj_t * pObj )
         p->pReprsProved[ pObj->Id ] = pObjRepr;
         return;
     }
+    // if the equivalence is proved by the concurrent threads, reuse it
+    if ( p->pParReprs && p->pParReprs[pObj->Id] == pObjRepr->Id )
+    {
+        pObjFraig2 = Aig_NotCond( pObjReprFraig, pObj->fPhase ^ pObjRepr->fPhase );
+        Dch_ObjSetFraig( pObj, pObjFraig2 );
+        p->pReprsProved[ pObj->Id ] = pObjRepr;
+        p->nParUsed++;
+        return;
+    }
     assert( Aig_Regular(pObjFraig) != Aig_ManConst1(p->pAigFraig) );
     RetValue = Dch_NodesAreEquiv( p, Aig_Regular(pObjReprFraig), Aig_Regular(pObjFraig) );
     if ( RetValue == -1 ) // timed out
@@ -108,6 +117,9 @@ void Dch_ManSweep( Dch_Man_t * p )
     Bar_Progress_t * pProgress = NULL;
     Aig_Obj_t * pObj, * pObjNew;
     int i;
+    // prove the candidate classes concurrently
+    if ( p->pPars->nProcs > 1 )
+        Dch_ManSweepPar( p );
     // map constants and PIs
     p->pAigFraig = Aig_ManStart( Aig_ManObjNumMax(p->pAigTotal) );
     Aig_ManCleanData( p->pAigTotal );
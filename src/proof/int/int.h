@@ -64,9 +64,13 @@ struct Inter_ManParams_t_
     int  fUseTwoFrames; // create the OR of two last timeframes
     int  fDropSatOuts;  // replace by 1 the solved outputs
     int  fDropInvar;    // dump inductive invariant into file
+    int  fUseOnline;    // compute interpolant online without storing the proof
+    int  nProcs;        // the number of concurrent interpolation sequences
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
     char * pFileName;   // file name to dump interpolant
+    int  RunId;         // interpolation id in this run
+    int(*pFuncStop)(int); // callback to terminate
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -220,7 +220,7 @@ int Inter_ManCheckInductiveContainment( Aig_Man_t * pTrans, Aig_Man_t * pInter,
     Aig_ManCleanup( pFrames );
 
     // convert to CNF
-    pCnf = Cnf_Derive( pFrames, 0 ); 
+    pCnf = Inter_ManCnfDerive( pFrames, 0 ); 
     pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
 //    Cnf_DataFree( pCnf );
 //    Aig_ManStop( pFrames );
@@ -61,6 +61,8 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
+    p->fUseOnline    = 0;     // compute interpolant online without storing the proof
+    p->nProcs        = 1;     // the number of concurrent interpolation sequences
     p->fVerbose      = 0;     // print verbose statistics
     p->iFrameMax     =-1;
 }
@@ -86,6 +88,10 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
     abctime clk, clk2, clkTotal = Abc_Clock(), timeTemp = 0;
     abctime nTimeNewOut = pPars->nSecLimit ? pPars->nSecLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
 
+    // run several interpolation sequences concurrently
+    if ( pPars->nProcs > 1 && pPars->pFuncStop == NULL && !Inter_ManCheckInitialState(pAig) )
+        return Inter_ManPerformInterpolationPar( pAig, pPars, piFrame );
+
     // enable ORing of the interpolants, if containment check is performed inductively with K > 1
     if ( pPars->nFramesK > 1 )
         pPars->fTransLoop = 1;
@@ -119,7 +125,7 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
         p->pAigTrans = Inter_ManStartDuplicated( pAig );
     // derive CNF for the transformed AIG
 clk = Abc_Clock();
-    p->pCnfAig = Cnf_Derive( p->pAigTrans, Aig_ManRegNum(p->pAigTrans) ); 
+    p->pCnfAig = Inter_ManCnfDerive( p->pAigTrans, Aig_ManRegNum(p->pAigTrans) ); 
 p->timeCnf += Abc_Clock() - clk;    
     if ( pPars->fVerbose )
     { 
@@ -144,14 +150,14 @@ clk2 = Abc_Clock();
             p->pInter = Inter_ManStartInitState( Aig_ManRegNum(pAig) );
         assert( Aig_ManCoNum(p->pInter) == 1 );
 clk = Abc_Clock();
-        p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+        p->pCnfInter = Inter_ManCnfDerive( p->pInter, 0 );  
 p->timeCnf += Abc_Clock() - clk;    
         // timeframes
         p->pFrames = Inter_ManFramesInter( pAig, p->nFrames, pPars->fUseBackward, pPars->fUseTwoFrames );
 clk = Abc_Clock();
         if ( pPars->fRewrite )
         {
-            p->pFrames = Dar_ManRwsat( pAigTemp = p->pFrames, 1, 0 );
+            p->pFrames = Inter_ManRwsat( pAigTemp = p->pFrames );
             Aig_ManStop( pAigTemp );
 //        p->pFrames = Fra_FraigEquivence( pAigTemp = p->pFrames, 100, 0 );
 //        Aig_ManStop( pAigTemp );
@@ -160,7 +166,7 @@ p->timeRwr += Abc_Clock() - clk;
         // can also do SAT sweeping on the timeframes...
 clk = Abc_Clock();
         if ( pPars->fUseBackward )
-            p->pCnfFrames = Cnf_Derive( p->pFrames, Aig_ManCoNum(p->pFrames) );  
+            p->pCnfFrames = Inter_ManCnfDerive( p->pFrames, Aig_ManCoNum(p->pFrames) );  
         else
 //            p->pCnfFrames = Cnf_Derive( p->pFrames, 0 );  
             p->pCnfFrames = Cnf_DeriveSimple( p->pFrames, 0 );  
@@ -181,7 +187,7 @@ p->timeCnf += Abc_Clock() - clk;
             pCheck = Inter_CheckStart( p->pAigTrans, pPars->nFramesK );
             // try new containment check for the initial state
 clk = Abc_Clock();
-            pCnfInter2 = Cnf_Derive( p->pInter, 1 );  
+            pCnfInter2 = Inter_ManCnfDerive( p->pInter, 1 );  
 p->timeCnf += Abc_Clock() - clk;    
 clk = Abc_Clock();
             RetValue = Inter_CheckPerform( pCheck, pCnfInter2, nTimeNewOut );
@@ -205,6 +211,15 @@ p->timeEqu += Abc_Clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            { 
+                if ( pPars->fVerbose )
+                    printf( "Interpolation is cancelled by another engine.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -216,6 +231,9 @@ p->timeEqu += Abc_Clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseOnline )
+                RetValue = Inter_ManPerformOneStepOnline( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
@@ -264,6 +282,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation is cancelled by another engine.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -283,7 +306,7 @@ clk = Abc_Clock();
                 // save the timeout value
                 p->pInterNew->Time2Quit = nTimeNewOut;
 //                Ioa_WriteAiger( p->pInterNew, "interpol.aig", 0, 0 );
-                p->pInterNew = Dar_ManRwsat( pAigTemp = p->pInterNew, 1, 0 );
+                p->pInterNew = Inter_ManRwsat( pAigTemp = p->pInterNew );
 //                p->pInterNew = Dar_ManRwsat( pAigTemp = p->pInterNew, 0, 0 );
                 Aig_ManStop( pAigTemp );
                 if ( p->pInterNew == NULL )
@@ -324,7 +347,7 @@ timeTemp = Abc_Clock() - clk2;
                     else
                     {   // new containment check
 clk2 = Abc_Clock();
-                        pCnfInter2 = Cnf_Derive( p->pInterNew, 1 );  
+                        pCnfInter2 = Inter_ManCnfDerive( p->pInterNew, 1 );  
 p->timeCnf += Abc_Clock() - clk2;
 timeTemp = Abc_Clock() - clk2;
             
@@ -377,7 +400,7 @@ p->timeEqu += Abc_Clock() - clk - timeTemp;
                     Aig_ManStop( p->pInterNew );
                     // compress the interpolant
 clk = Abc_Clock();
-                    p->pInter = Dar_ManRwsat( pAigTemp = p->pInter, 1, 0 );
+                    p->pInter = Inter_ManRwsat( pAigTemp = p->pInter );
                     Aig_ManStop( pAigTemp );
 p->timeRwr += Abc_Clock() - clk;
                 }
@@ -390,7 +413,7 @@ p->timeRwr += Abc_Clock() - clk;
             p->pInterNew = NULL;
             Cnf_DataFree( p->pCnfInter );
 clk = Abc_Clock();
-            p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+            p->pCnfInter = Inter_ManCnfDerive( p->pInter, 0 );  
 p->timeCnf += Abc_Clock() - clk;
         }
 
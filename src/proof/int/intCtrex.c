@@ -106,7 +106,7 @@ void * Inter_ManGetCounterExample( Aig_Man_t * pAig, int nFrames, int fVerbose )
     assert( Saig_ManPoNum(pAig) == 1 );
     pFrames = Inter_ManFramesBmc( pAig, nFrames );
     // derive CNF
-    pCnf = Cnf_Derive( pFrames, 0 );
+    pCnf = Inter_ManCnfDerive( pFrames, 0 );
     Cnf_DataTranformPolarity( pCnf, 0 );
     vCiIds = Cnf_DataCollectPiSatNums( pCnf, pFrames );
     Aig_ManStop( pFrames );
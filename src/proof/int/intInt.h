@@ -70,6 +70,8 @@ struct Inter_Man_t_
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
+    int              RunId;        // interpolation id in this run
+    int(*pFuncStop)(int);          // callback to terminate
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -125,6 +127,14 @@ extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, i
 extern int             Inter_ManPerformOneStepM114p( Inter_Man_t * p, int fUsePudlak, int fUseOther );
 #endif
 
+/*=== intOnline.c ============================================================*/
+extern int             Inter_ManPerformOneStepOnline( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut );
+
+/*=== intPth.c ============================================================*/
+extern Cnf_Dat_t *     Inter_ManCnfDerive( Aig_Man_t * pAig, int nOutputs );
+extern Aig_Man_t *     Inter_ManRwsat( Aig_Man_t * pAig );
+extern int             Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
+
 /*=== intUtil.c ============================================================*/
 extern int             Inter_ManCheckInitialState( Aig_Man_t * p );
 extern int             Inter_ManCheckAllStates( Aig_Man_t * p );
@@ -0,0 +1,285 @@
+/**CFile****************************************************************
+
+  FileName    [intOnline.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation computed while the proof is being derived.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: intOnline.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "sat/bsat/satSolver2.h"
+#include "aig/gia/giaAig.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of one CNF to the solver.]
+
+  Description [Unit clauses are skipped and collected in vUnits because
+  they are added after all other clauses (see below).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Inter_ManOnlineAddCnf( sat_solver2 * pSat, Cnf_Dat_t * pCnf, int fPartA, Vec_Int_t * vUnits )
+{
+    int i, Cid;
+    for ( i = 0; i < pCnf->nClauses; i++ )
+    {
+        if ( pCnf->pClauses[i+1] - pCnf->pClauses[i] == 1 )
+        {
+            Vec_IntPush( vUnits, Abc_Var2Lit(pCnf->pClauses[i][0], fPartA) );
+            continue;
+        }
+        Cid = sat_solver2_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1], -1 );
+        clause2_set_partA( pSat, Cid, fPartA );
+    }
+}
+static void Inter_ManOnlineAddBuffer( sat_solver2 * pSat, int iVarA, int iVarB, int fPartA )
+{
+    lit Lits[2];
+    int Cid;
+    Lits[0] = toLitCond( iVarA, 0 );
+    Lits[1] = toLitCond( iVarB, 1 );
+    Cid = sat_solver2_addclause( pSat, Lits, Lits + 2, -1 );
+    clause2_set_partA( pSat, Cid, fPartA );
+    Lits[0] = toLitCond( iVarA, 1 );
+    Lits[1] = toLitCond( iVarB, 0 );
+    Cid = sat_solver2_addclause( pSat, Lits, Lits + 2, -1 );
+    clause2_set_partA( pSat, Cid, fPartA );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT solver for one interpolation run.]
+
+  Description [Same as Inter_ManDeriveSatSolver() but the proof is not
+  recorded. Instead, the solver computes the partial interpolant of each
+  learned clause when the clause is derived. The variables are numbered
+  as in Inter_ManDeriveSatSolver(): the timeframes (part B) come first,
+  followed by the transition relation and the previous interpolant
+  (part A). The clauses of part A are marked before the solver derives
+  anything from them, which is why the unit clauses, whose addition may
+  trigger logging of derived units, are added last. Returns NULL if the
+  problem is found unsatisfiable while adding the clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+sat_solver2 * Inter_ManDeriveSatSolverOnline(
+    Aig_Man_t * pInter, Cnf_Dat_t * pCnfInter,
+    Aig_Man_t * pAig, Cnf_Dat_t * pCnfAig,
+    Aig_Man_t * pFrames, Cnf_Dat_t * pCnfFrames,
+    Vec_Int_t * vVarsAB, int fUseBackward )
+{
+    sat_solver2 * pSat;
+    Aig_Obj_t * pObj, * pObj2;
+    Vec_Int_t * vUnits;
+    int i, Lit, Cid, nVars;
+
+    // sanity checks
+    assert( Aig_ManRegNum(pInter) == 0 );
+    assert( Aig_ManRegNum(pAig) > 0 );
+    assert( Aig_ManRegNum(pFrames) == 0 );
+    assert( Aig_ManCoNum(pInter) == 1 );
+    assert( fUseBackward || Aig_ManCiNum(pInter) == Aig_ManRegNum(pAig) );
+
+    // prepare CNFs
+    Cnf_DataLift( pCnfAig,   pCnfFrames->nVars );
+    Cnf_DataLift( pCnfInter, pCnfFrames->nVars + pCnfAig->nVars );
+
+    // start the solver
+    nVars = pCnfInter->nVars + pCnfAig->nVars + pCnfFrames->nVars;
+    pSat = sat_solver2_new();
+    sat_solver2_setnvars( pSat, nVars );
+    for ( i = pCnfFrames->nVars; i < nVars; i++ )
+        var_set_partA( pSat, i, 1 );
+    vUnits = Vec_IntAlloc( 100 );
+
+    // add clauses of A
+    // interpolant
+    Inter_ManOnlineAddCnf( pSat, pCnfInter, 1, vUnits );
+    // connector clauses
+    if ( fUseBackward )
+    {
+        Saig_ManForEachLi( pAig, pObj2, i )
+        {
+            if ( Saig_ManRegNum(pAig) == Aig_ManCiNum(pInter) )
+                pObj = Aig_ManCi( pInter, i );
+            else
+            {
+                assert( Aig_ManCiNum(pAig) == Aig_ManCiNum(pInter) );
+                pObj = Aig_ManCi( pInter, Aig_ManCiNum(pAig)-Saig_ManRegNum(pAig) + i );
+            }
+            Inter_ManOnlineAddBuffer( pSat, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id], 1 );
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pInter, pObj, i )
+        {
+            pObj2 = Saig_ManLo( pAig, i );
+            Inter_ManOnlineAddBuffer( pSat, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id], 1 );
+        }
+    }
+    // one timeframe
+    Inter_ManOnlineAddCnf( pSat, pCnfAig, 1, vUnits );
+    // connector clauses
+    Vec_IntClear( vVarsAB );
+    if ( fUseBackward )
+    {
+        Aig_ManForEachCo( pFrames, pObj, i )
+        {
+            assert( pCnfFrames->pVarNums[pObj->Id] >= 0 );
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+            pObj2 = Saig_ManLo( pAig, i );
+            Inter_ManOnlineAddBuffer( pSat, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id], 1 );
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pFrames, pObj, i )
+        {
+            if ( i == Aig_ManRegNum(pAig) )
+                break;
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+            pObj2 = Saig_ManLi( pAig, i );
+            Inter_ManOnlineAddBuffer( pSat, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id], 1 );
+        }
+    }
+    // add clauses of B
+    Inter_ManOnlineAddCnf( pSat, pCnfFrames, 0, vUnits );
+
+    // add unit clauses (the part is stored in the complement bit)
+    Vec_IntForEachEntry( vUnits, Lit, i )
+    {
+        int Var = Abc_Lit2Var(Abc_Lit2Var(Lit)), fCompl = Abc_LitIsCompl(Abc_Lit2Var(Lit));
+        if ( var_is_assigned(pSat, Var) )
+        {
+            // the clause is satisfied by another unit and can be skipped
+            if ( pSat->assigns[Var] == fCompl )
+                continue;
+            // the problem is trivially unsatisfiable
+            sat_solver2_delete( pSat );
+            pSat = NULL;
+            break;
+        }
+        Lit = Abc_Lit2Var(Lit);
+        Cid = sat_solver2_addclause( pSat, &Lit, &Lit + 1, -1 );
+        clause2_set_partA( pSat, Cid, Abc_LitIsCompl(Vec_IntEntry(vUnits, i)) );
+    }
+    Vec_IntFree( vUnits );
+
+    // return clauses to the original state
+    Cnf_DataLift( pCnfAig, -pCnfFrames->nVars );
+    Cnf_DataLift( pCnfInter, -pCnfFrames->nVars -pCnfAig->nVars );
+    if ( pSat == NULL )
+        return NULL;
+
+    // start the interpolation manager
+    pSat->pInt2 = Int2_ManStart( pSat, Vec_IntArray(vVarsAB), Vec_IntSize(vVarsAB) );
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with online interpolation.]
+
+  Description [Unlike Inter_ManPerformOneStep(), the resolution proof is
+  not stored. The partial interpolants of the learned clauses are built
+  as AIG nodes during solving and the nodes used only by the deleted
+  clauses are removed when the clause database is reduced, so the memory
+  follows the part of the proof that is still alive. When the solver
+  cannot be constructed (for example, the problem is trivially
+  unsatisfiable) or when bias toward global variables is requested,
+  which this solver does not support, falls back to the standard
+  procedure. Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepOnline( Inter_Man_t * p, int fUseBias, int fUseBackward, abctime nTimeNewOut )
+{
+    sat_solver2 * pSat;
+    Gia_Man_t * pGia;
+    int status;
+    abctime clk;
+
+    if ( fUseBias )
+        return Inter_ManPerformOneStep( p, fUseBias, fUseBackward, nTimeNewOut );
+
+    // derive the SAT solver
+    pSat = Inter_ManDeriveSatSolverOnline( p->pInter, p->pCnfInter, p->pAigTrans, p->pCnfAig, p->pFrames, p->pCnfFrames, p->vVarsAB, fUseBackward );
+    if ( pSat == NULL )
+        return Inter_ManPerformOneStep( p, fUseBias, fUseBackward, nTimeNewOut );
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver2_set_runtime_limit( pSat, nTimeNewOut );
+    sat_solver2_set_runid( pSat, p->RunId );
+    sat_solver2_set_stop_func( pSat, p->pFuncStop );
+
+    // solve the problem
+clk = Abc_Clock();
+    status = sat_solver2_solve( pSat, NULL, NULL, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = pSat->stats.conflicts;
+p->timeSat += Abc_Clock() - clk;
+
+    if ( status == l_True )
+    {
+        sat_solver2_delete( pSat );
+        return 0;
+    }
+    if ( status != l_False )
+    {
+        sat_solver2_delete( pSat );
+        return -1;
+    }
+
+    // create the resulting manager
+clk = Abc_Clock();
+    pGia = (Gia_Man_t *)Int2_ManReadInterpolant( pSat );
+    sat_solver2_delete( pSat );
+    if ( pGia == NULL )
+        return Inter_ManPerformOneStep( p, fUseBias, fUseBackward, nTimeNewOut );
+    assert( Gia_ManCiNum(pGia) == Vec_IntSize(p->vVarsAB) );
+    p->pInterNew = Gia_ManToAigSimple( pGia );
+    Gia_ManStop( pGia );
+p->timeInt += Abc_Clock() - clk;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,257 @@
+/**CFile****************************************************************
+
+  FileName    [intPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Running several interpolation sequences concurrently.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: intPth.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the number of distinct interpolation sequences
+#define INT_PAR_THR_MAX 4
+
+#ifdef ABC_USE_PTHREADS
+
+// information given to the thread
+typedef struct Inter_ThData_t_
+{
+    Aig_Man_t *       pAig;        // the copy of the AIG used by this thread
+    Inter_ManParams_t Pars;        // the parameters of this sequence
+    int               iThread;     // the number of this sequence
+    int               iFrame;      // the frame of the counter-example
+    int               RetValue;    // the result of this sequence
+    abctime           clkUsed;     // the runtime of this sequence
+} Inter_ThData_t;
+
+// mutex to control access to shared variables
+static pthread_mutex_t g_InterMutex = PTHREAD_MUTEX_INITIALIZER;
+static volatile int    g_nInterRunIds = 0;  // the number of the last parallel run
+static volatile int    g_iInterWinner = -1; // the sequence that finished first
+
+// call back procedure for the interpolation engine
+int Inter_CallBackToStop( int RunId ) { assert( RunId <= g_nInterRunIds ); return RunId < g_nInterRunIds; }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Calls the procedures using managers shared by all threads.]
+
+  Description [The CNF manager used by Cnf_Derive() and the subgraph
+  library used by rewriting are global, so concurrent sequences take
+  turns calling them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Inter_ManCnfDerive( Aig_Man_t * pAig, int nOutputs )
+{
+    Cnf_Dat_t * pCnf;
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock(&g_InterMutex);  assert( status == 0 );
+#endif
+    pCnf = Cnf_Derive( pAig, nOutputs );
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock(&g_InterMutex);  assert( status == 0 );
+#endif
+    return pCnf;
+}
+Aig_Man_t * Inter_ManRwsat( Aig_Man_t * pAig )
+{
+    Aig_Man_t * pNew;
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock(&g_InterMutex);  assert( status == 0 );
+#endif
+    pNew = Dar_ManRwsat( pAig, 1, 0 );
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock(&g_InterMutex);  assert( status == 0 );
+#endif
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of the given interpolation sequence.]
+
+  Description [Sequence 0 uses the parameters given by the user. The
+  others toggle the direction of interpolation and the bias of the SAT
+  solver toward the global variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManSetSequenceParams( Inter_ManParams_t * p, int iSeq )
+{
+    if ( iSeq & 1 )
+        p->fUseBackward ^= 1;
+    if ( iSeq & 2 )
+        p->fUseBias ^= 1;
+    // backward interpolation needs the transition into the initial state
+    // and is only implemented with the internal proof engine
+    if ( p->fUseBackward )
+        p->fTransLoop = 1, p->fUseMiniSat = 0;
+    // the interpolants of one sequence are dumped
+    if ( iSeq > 0 )
+        p->fDropInvar = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several interpolation sequences concurrently.]
+
+  Description [Each sequence works on its own copy of the AIG. The first
+  sequence to prove or disprove the property stops the others and its
+  result is returned. Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Inter_WorkerThread( void * pArg )
+{
+    Inter_ThData_t * pThData = (Inter_ThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    int status;
+    pThData->RetValue = Inter_ManPerformInterpolation( pThData->pAig, &pThData->Pars, &pThData->iFrame );
+    pThData->clkUsed  = Abc_Clock() - clk;
+    if ( pThData->RetValue == -1 )
+        return NULL;
+    // the first decided sequence stops the others
+    status = pthread_mutex_lock(&g_InterMutex);  assert( status == 0 );
+    if ( g_iInterWinner == -1 && pThData->Pars.RunId == g_nInterRunIds )
+    {
+        g_iInterWinner = pThData->iThread;
+        g_nInterRunIds++;
+    }
+    status = pthread_mutex_unlock(&g_InterMutex);  assert( status == 0 );
+    return NULL;
+}
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    Inter_ThData_t ThData[INT_PAR_THR_MAX];
+    pthread_t WorkerThread[INT_PAR_THR_MAX];
+    char * pNames[4] = { "forward", "backward", "biased forward", "biased backward" };
+    int i, status, RunId, nProcs = Abc_MinInt( pPars->nProcs, INT_PAR_THR_MAX );
+    int RetValue = -1;
+    // start a new run
+    status = pthread_mutex_lock(&g_InterMutex);  assert( status == 0 );
+    RunId = ++g_nInterRunIds;
+    g_iInterWinner = -1;
+    status = pthread_mutex_unlock(&g_InterMutex);  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pAig      = Aig_ManDupSimple( pAig );
+        ThData[i].Pars      = *pPars;
+        ThData[i].Pars.nProcs    = 1;
+        ThData[i].Pars.RunId     = RunId;
+        ThData[i].Pars.pFuncStop = Inter_CallBackToStop;
+        ThData[i].Pars.fVerbose  = pPars->fVerbose && i == 0;
+        Inter_ManSetSequenceParams( &ThData[i].Pars, i );
+        ThData[i].iThread   = i;
+        ThData[i].iFrame    = -1;
+        ThData[i].RetValue  = -1;
+        ThData[i].clkUsed   = 0;
+    }
+    // the calling thread runs the sequence given by the user
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Inter_WorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Inter_WorkerThread( (void *)ThData );
+    for ( i = 1; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    // collect the result of the winner
+    *piFrame = -1;
+    if ( g_iInterWinner >= 0 )
+    {
+        Inter_ThData_t * pWin = ThData + g_iInterWinner;
+        RetValue = pWin->RetValue;
+        *piFrame = pWin->iFrame;
+        if ( pWin->pAig->pSeqModel )
+        {
+            ABC_FREE( pAig->pSeqModel );
+            pAig->pSeqModel = pWin->pAig->pSeqModel;
+            pWin->pAig->pSeqModel = NULL;
+        }
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pPars->iFrameMax = Abc_MaxInt( pPars->iFrameMax, ThData[i].Pars.iFrameMax );
+        if ( pPars->fVerbose )
+        {
+            printf( "Sequence %d (%-15s) : ", i, pNames[i] );
+            printf( "%-10s", ThData[i].RetValue == 1 ? "proved" : ThData[i].RetValue == 0 ? "disproved" : "undecided" );
+            printf( "%s", i == g_iInterWinner ? "  first" : "       " );
+            printf( "  Frames = %3d.  ", ThData[i].Pars.iFrameMax + 1 );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+        Aig_ManStop( ThData[i].pAig );
+    }
+    return RetValue;
+}
+#else
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    Inter_ManParams_t Pars = *pPars;
+    int RetValue;
+    Pars.nProcs = 1;
+    RetValue = Inter_ManPerformInterpolation( pAig, &Pars, piFrame );
+    pPars->iFrameMax = Pars.iFrameMax;
+    return RetValue;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
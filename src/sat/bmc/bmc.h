@@ -168,6 +168,20 @@ struct Bmc_BCorePar_t_
     int         fVerbose;       // verbose output
 };
 
+typedef struct Bmc_KIndPar_t_ Bmc_KIndPar_t;
+struct Bmc_KIndPar_t_
+{
+    int         nFramesMax;     // the maximum induction depth
+    int         nConfLimit;     // the conflict limit of one SAT call
+    int         nTimeOut;       // approximate timeout in seconds
+    int         fUnique;        // add uniqueness constraints when needed
+    int         fUseInvar;      // strengthen the step with the stored invariant
+    int         nProcs;         // the number of threads (2 = base and step in parallel)
+    int         fVerbose;       // verbose output
+    int         iFrame;         // the last frame proved by the base case
+    int         iDepth;         // the depth at which the step case holds
+};
+
 typedef struct Bmc_MulPar_t_ Bmc_MulPar_t;
 struct Bmc_MulPar_t_
 {
@@ -178,6 +192,7 @@ struct Bmc_MulPar_t_
     int         TimePerOut;
     int         fUseSyn;
     int         fDumpFinal;
+    int         nProcs;
     int         fVerbose;
     int         fVeryVerbose;
 };
@@ -241,6 +256,9 @@ extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcKInd.c ==========================================================*/
+extern void              Bmc_KIndSetDefaultParams( Bmc_KIndPar_t * pPars );
+extern int               Bmc_PerformKInd( Gia_Man_t * p, Bmc_KIndPar_t * pPars, Vec_Int_t * vInv );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
@@ -0,0 +1,741 @@
+/**CFile****************************************************************
+
+  FileName    [bmcKInd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [K-step induction with incremental solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: bmcKInd.c,v 1.00 2026/10/18 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver.h"
+#include "aig/gia/giaAig.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the unrolling used by the base case or by the inductive step
+typedef struct Bmc_KMan_t_ Bmc_KMan_t;
+struct Bmc_KMan_t_
+{
+    Gia_Man_t *      pGia;         // the design
+    Bmc_KIndPar_t *  pPars;        // parameters
+    Cnf_Dat_t *      pCnf;         // CNF of one timeframe (shared by both unrollings)
+    Vec_Int_t *      vInv;         // the invariant added in each timeframe (or NULL)
+    sat_solver *     pSat;         // incremental SAT solver
+    Vec_Int_t *      vShifts;      // the first SAT variable of each timeframe
+    Vec_Int_t *      vLits;        // temporary literals
+    Abc_Cex_t *      pCex;         // the counter-example found by the base case
+    int              fInit;        // the first timeframe is in the initial state
+    int              nSatVars;     // the number of SAT variables used
+    int              nUniques;     // the number of uniqueness constraints added
+    int              nSatCalls;    // the number of SAT calls
+};
+
+// iterator over the cubes of the invariant (see Pdr_ManDeriveInfinityClauses)
+#define Bmc_KIndForEachCube( pList, pCube, i ) for ( i = 0, pCube = pList + 1; i < pList[0]; i++, pCube += pCube[0] + 1 )
+
+#ifdef ABC_USE_PTHREADS
+
+// mutex to control access to shared variables
+static pthread_mutex_t g_KIndMutex = PTHREAD_MUTEX_INITIALIZER;
+static volatile int    g_nKIndRunIds = 0;  // the number of the last run
+static volatile int    g_iKIndBase   = -1; // the last frame proved by the base case
+static volatile int    g_iKIndStep   = -1; // the depth at which the step case holds
+
+// call back procedure for the SAT solvers
+int Bmc_KIndCallBackToStop( int RunId ) { assert( RunId <= g_nKIndRunIds ); return RunId < g_nKIndRunIds; }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Cnf_Dat_t * Cnf_DeriveGiaRemapped( Gia_Man_t * p )
+{
+    Cnf_Dat_t * pCnf;
+    Aig_Man_t * pAig = Gia_ManToAigSimple( p );
+    pAig->nRegs = 0;
+    pCnf = Cnf_Derive( pAig, Aig_ManCoNum(pAig) );
+    Aig_ManStop( pAig );
+    return pCnf;
+}
+static inline int Bmc_KManVar( Bmc_KMan_t * p, int f, Gia_Obj_t * pObj )
+{
+    int iVar = p->pCnf->pVarNums[Gia_ObjId(p->pGia, pObj)];
+    return iVar < 0 ? -1 : Vec_IntEntry(p->vShifts, f) + iVar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the default parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KIndSetDefaultParams( Bmc_KIndPar_t * pPars )
+{
+    memset( pPars, 0, sizeof(Bmc_KIndPar_t) );
+    pPars->nFramesMax = 100;     // the maximum induction depth
+    pPars->nConfLimit = 0;       // the conflict limit of one SAT call
+    pPars->nTimeOut   = 0;       // approximate timeout in seconds
+    pPars->fUnique    = 1;       // add uniqueness constraints when needed
+    pPars->fUseInvar  = 0;       // strengthen the step with the stored invariant
+    pPars->nProcs     = 1;       // the number of threads
+    pPars->fVerbose   = 0;       // verbose output
+    pPars->iFrame     = -1;      // the last frame proved by the base case
+    pPars->iDepth     = -1;      // the depth at which the step case holds
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the unrolling.]
+
+  Description [The base case (fInit = 1) starts in the initial state.
+  The inductive step (fInit = 0) starts in an arbitrary state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_KMan_t * Bmc_KManStart( Gia_Man_t * pGia, Cnf_Dat_t * pCnf, Vec_Int_t * vInv, Bmc_KIndPar_t * pPars, int fInit, abctime nTimeToStop )
+{
+    Bmc_KMan_t * p;
+    p = ABC_CALLOC( Bmc_KMan_t, 1 );
+    p->pGia    = pGia;
+    p->pPars   = pPars;
+    p->pCnf    = pCnf;
+    p->vInv    = vInv;
+    p->fInit   = fInit;
+    p->vShifts = Vec_IntAlloc( 100 );
+    p->vLits   = Vec_IntAlloc( 100 );
+    p->pSat    = sat_solver_new();
+    sat_solver_setnvars( p->pSat, 1000 );
+    if ( nTimeToStop )
+        sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
+    return p;
+}
+void Bmc_KManStop( Bmc_KMan_t * p )
+{
+    sat_solver_delete( p->pSat );
+    Vec_IntFree( p->vShifts );
+    Vec_IntFree( p->vLits );
+    ABC_FREE( p->pCex );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses of the next timeframe.]
+
+  Description [Returns 0 if the solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManAddFrame( Bmc_KMan_t * p )
+{
+    Gia_Obj_t * pObjRi, * pObjRo;
+    int f = Vec_IntSize(p->vShifts);
+    int i, Lit, * pLit, iVarRo, iVarRi;
+    Vec_IntPush( p->vShifts, p->nSatVars );
+    p->nSatVars += p->pCnf->nVars;
+    // add the clauses of this timeframe
+    for ( i = 0; i < p->pCnf->nClauses; i++ )
+    {
+        Vec_IntClear( p->vLits );
+        for ( pLit = p->pCnf->pClauses[i]; pLit < p->pCnf->pClauses[i+1]; pLit++ )
+            Vec_IntPush( p->vLits, *pLit + 2 * Vec_IntEntry(p->vShifts, f) );
+        if ( !sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) ) )
+            return 0;
+    }
+    // connect the flop outputs to the initial state or to the previous timeframe
+    Gia_ManForEachRiRo( p->pGia, pObjRi, pObjRo, i )
+    {
+        iVarRo = Bmc_KManVar( p, f, pObjRo );
+        assert( iVarRo >= 0 );
+        if ( f == 0 )
+        {
+            if ( !p->fInit )
+                continue;
+            Lit = Abc_Var2Lit( iVarRo, 1 );
+            if ( !sat_solver_addclause( p->pSat, &Lit, &Lit + 1 ) )
+                return 0;
+            continue;
+        }
+        iVarRi = Bmc_KManVar( p, f-1, pObjRi );
+        assert( iVarRi >= 0 );
+        if ( !sat_solver_add_buffer( p->pSat, iVarRo, iVarRi, 0 ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Asserts that the property holds in the given timeframe.]
+
+  Description [Returns 0 if the solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManAssertProperty( Bmc_KMan_t * p, int f )
+{
+    Gia_Obj_t * pObj;
+    int i, Lit;
+    Gia_ManForEachPo( p->pGia, pObj, i )
+    {
+        Lit = Abc_Var2Lit( Bmc_KManVar(p, f, pObj), 1 );
+        if ( !sat_solver_addclause( p->pSat, &Lit, &Lit + 1 ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal that is true if one of the outputs fails.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManBadLit( Bmc_KMan_t * p, int f )
+{
+    Gia_Obj_t * pObj;
+    int i, iVarBad = p->nSatVars++;
+    Vec_IntFill( p->vLits, 1, Abc_Var2Lit(iVarBad, 1) );
+    Gia_ManForEachPo( p->pGia, pObj, i )
+        Vec_IntPush( p->vLits, Abc_Var2Lit(Bmc_KManVar(p, f, pObj), 0) );
+    sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) );
+    return Abc_Var2Lit( iVarBad, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of the invariant to the given timeframe.]
+
+  Description [The invariant is stored as in Pdr_ManDeriveInfinityClauses():
+  the number of cubes, followed by the cubes (each given by the number of
+  literals and the flop literals), followed by the number of flops. Each
+  cube is a set of states that is not reachable, so the clause added is
+  its complement. Returns 0 if the solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManAddInvariant( Bmc_KMan_t * p, int f )
+{
+    int i, k, * pCube, * pList = Vec_IntArray(p->vInv);
+    Bmc_KIndForEachCube( pList, pCube, i )
+    {
+        Vec_IntClear( p->vLits );
+        for ( k = 0; k < pCube[0]; k++ )
+        {
+            int iVar = Bmc_KManVar( p, f, Gia_ManRo(p->pGia, Abc_Lit2Var(pCube[k+1])) );
+            Vec_IntPush( p->vLits, Abc_Var2Lit(iVar, !Abc_LitIsCompl(pCube[k+1])) );
+        }
+        if ( Vec_IntSize(p->vLits) == 0 )
+            return 0;
+        if ( !sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the invariant can be used for strengthening.]
+
+  Description [The invariant should match the design, include the initial
+  state, and be inductive by itself. This check costs one SAT call and
+  protects against using an invariant computed for a different design.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KIndCheckInvariant( Gia_Man_t * pGia, Cnf_Dat_t * pCnf, Vec_Int_t * vInv, Bmc_KIndPar_t * pPars )
+{
+    Bmc_KMan_t * p;
+    Vec_Int_t * vOr;
+    int i, k, status, iVarCube, * pCube, * pList = Vec_IntArray(vInv);
+    if ( Vec_IntEntryLast(vInv) != Gia_ManRegNum(pGia) )
+    {
+        printf( "The invariant is given for %d flops while the design has %d flops.\n", Vec_IntEntryLast(vInv), Gia_ManRegNum(pGia) );
+        return 0;
+    }
+    // the initial state should not belong to any cube
+    Bmc_KIndForEachCube( pList, pCube, i )
+    {
+        for ( k = 0; k < pCube[0]; k++ )
+            if ( !Abc_LitIsCompl(pCube[k+1]) )
+                break;
+        if ( k == pCube[0] )
+        {
+            printf( "The invariant does not contain the initial state.\n" );
+            return 0;
+        }
+    }
+    // the next state should not belong to any cube
+    p = Bmc_KManStart( pGia, pCnf, vInv, pPars, 0, 0 );
+    status = Bmc_KManAddFrame( p ) && Bmc_KManAddInvariant( p, 0 ) && Bmc_KManAddFrame( p );
+    if ( status )
+    {
+        vOr = Vec_IntAlloc( pList[0] );
+        Bmc_KIndForEachCube( pList, pCube, i )
+        {
+            iVarCube = p->nSatVars++;
+            Vec_IntPush( vOr, Abc_Var2Lit(iVarCube, 0) );
+            for ( k = 0; k < pCube[0]; k++ )
+            {
+                int iVar = Bmc_KManVar( p, 1, Gia_ManRo(pGia, Abc_Lit2Var(pCube[k+1])) );
+                int Lits[2] = { Abc_Var2Lit(iVarCube, 1), Abc_Var2Lit(iVar, Abc_LitIsCompl(pCube[k+1])) };
+                sat_solver_addclause( p->pSat, Lits, Lits + 2 );
+            }
+        }
+        status = Vec_IntSize(vOr) && sat_solver_addclause( p->pSat, Vec_IntArray(vOr), Vec_IntLimit(vOr) );
+        Vec_IntFree( vOr );
+        if ( status )
+            status = sat_solver_solve( p->pSat, NULL, NULL, (ABC_INT64_T)pPars->nConfLimit, 0, 0, 0 ) != l_False;
+    }
+    Bmc_KManStop( p );
+    if ( status )
+    {
+        printf( "The invariant is not inductive.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds uniqueness constraint for the states in two timeframes.]
+
+  Description [Returns 0 if the solver became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManStatesAreEqual( Bmc_KMan_t * p, int i, int k )
+{
+    Gia_Obj_t * pObj;
+    int v;
+    Gia_ManForEachRo( p->pGia, pObj, v )
+        if ( sat_solver_var_value(p->pSat, Bmc_KManVar(p, i, pObj)) != sat_solver_var_value(p->pSat, Bmc_KManVar(p, k, pObj)) )
+            return 0;
+    return 1;
+}
+int Bmc_KManAddUniqueness( Bmc_KMan_t * p, int i, int k )
+{
+    Gia_Obj_t * pObj;
+    int v, iVarXor;
+    Vec_IntClear( p->vLits );
+    Gia_ManForEachRo( p->pGia, pObj, v )
+    {
+        iVarXor = p->nSatVars++;
+        sat_solver_add_xor( p->pSat, iVarXor, Bmc_KManVar(p, i, pObj), Bmc_KManVar(p, k, pObj), 0 );
+        Vec_IntPush( p->vLits, Abc_Var2Lit(iVarXor, 0) );
+    }
+    p->nUniques++;
+    return sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntLimit(p->vLits) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the property can fail in the last timeframe.]
+
+  Description [In the inductive step, when the path to the failure goes
+  through the same state twice, the uniqueness constraint for these two
+  states is added and the problem is solved again. The constraints are
+  added only when needed and stay in the solver for the larger depths.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManSolve( Bmc_KMan_t * p, int f )
+{
+    int i, k, fAdded, status, Lit = Bmc_KManBadLit( p, f );
+    while ( 1 )
+    {
+        // the other side of the parallel run has decided
+        if ( p->pSat->pFuncStop && p->pSat->pFuncStop(p->pSat->RunId) )
+            return l_Undef;
+        p->nSatCalls++;
+        status = sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, 0, 0, 0 );
+        if ( status != l_True || p->fInit || !p->pPars->fUnique )
+            return status;
+        fAdded = 0;
+        for ( i = 0; i < f; i++ )
+        for ( k = i + 1; k <= f; k++ )
+            if ( Bmc_KManStatesAreEqual( p, i, k ) )
+            {
+                if ( !Bmc_KManAddUniqueness( p, i, k ) )
+                    return l_False;
+                fAdded = 1;
+            }
+        if ( !fAdded )
+            return l_True;
+    }
+    return l_Undef;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example after the base case is SAT.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Bmc_KManDeriveCex( Bmc_KMan_t * p, int f )
+{
+    Abc_Cex_t * pCex;
+    Gia_Obj_t * pObj;
+    int i, k;
+    pCex = Abc_CexAlloc( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), f+1 );
+    pCex->iFrame = f;
+    pCex->iPo    = -1;
+    Gia_ManForEachPo( p->pGia, pObj, i )
+        if ( sat_solver_var_value(p->pSat, Bmc_KManVar(p, f, pObj)) )
+        {
+            pCex->iPo = i;
+            break;
+        }
+    assert( pCex->iPo >= 0 );
+    for ( i = 0; i <= f; i++ )
+        Gia_ManForEachPi( p->pGia, pObj, k )
+            if ( sat_solver_var_value(p->pSat, Bmc_KManVar(p, i, pObj)) )
+                Abc_InfoSetBit( pCex->pData, pCex->nRegs + i * pCex->nPis + k );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the base case and the inductive step at one depth.]
+
+  Description [The base case returns l_True if the property fails in
+  frame f. The step returns l_False if the property holding in frames
+  0, 1, ..., k-1 implies that it holds in frame k.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KManBaseFrame( Bmc_KMan_t * p, int f )
+{
+    int status;
+    assert( p->fInit && Vec_IntSize(p->vShifts) == f );
+    if ( !Bmc_KManAddFrame( p ) )
+        return l_False;
+    status = Bmc_KManSolve( p, f );
+    if ( status == l_True )
+        p->pCex = Bmc_KManDeriveCex( p, f );
+    else if ( status == l_False )
+        Bmc_KManAssertProperty( p, f );
+    return status;
+}
+int Bmc_KManStepFrame( Bmc_KMan_t * p, int k )
+{
+    assert( !p->fInit && Vec_IntSize(p->vShifts) == k );
+    if ( k > 0 && !Bmc_KManAssertProperty( p, k-1 ) )
+        return l_False;
+    if ( !Bmc_KManAddFrame( p ) )
+        return l_False;
+    if ( p->vInv && !Bmc_KManAddInvariant( p, k ) )
+        return l_False;
+    return Bmc_KManSolve( p, k );
+}
+void Bmc_KManPrintFrame( Bmc_KMan_t * pBase, Bmc_KMan_t * pStep, int k, int status, int iBase, abctime clk )
+{
+    printf( "Depth %4d : ", k );
+    printf( "Base = %4d.  ", iBase + 1 );
+    printf( "Step = %-5s  ", status == l_False ? "UNSAT" : status == l_True ? "SAT" : "UNDEC" );
+    printf( "Uniq =%5d.  ", pStep->nUniques );
+    printf( "Var =%8d.  ", pBase->nSatVars + pStep->nSatVars );
+    printf( "Conf =%9d.  ", (int)(pBase->pSat->stats.conflicts + pStep->pSat->stats.conflicts) );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Alternates the base case and the step on one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KIndSolveSeq( Bmc_KMan_t * pBase, Bmc_KMan_t * pStep, Bmc_KIndPar_t * pPars )
+{
+    abctime clk = Abc_Clock();
+    int k, status;
+    for ( k = 0; k < pPars->nFramesMax; k++ )
+    {
+        status = Bmc_KManBaseFrame( pBase, k );
+        if ( status == l_True )
+            return 0;
+        if ( status == l_Undef )
+            break;
+        pPars->iFrame = k;
+        status = Bmc_KManStepFrame( pStep, k );
+        if ( pPars->fVerbose )
+            Bmc_KManPrintFrame( pBase, pStep, k, status, pPars->iFrame, clk );
+        if ( status == l_False )
+        {
+            pPars->iDepth = k;
+            return 1;
+        }
+        if ( status == l_Undef )
+            break;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the base case and the step on separate threads.]
+
+  Description [The base case is unrolled on a new thread while the calling
+  thread deepens the inductive step. When the step holds at depth k, the
+  base case continues until frame k-1 is proved. When the base case finds
+  a counter-example or runs out of resources, the step is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+void * Bmc_KIndBaseThread( void * pArg )
+{
+    Bmc_KMan_t * p = (Bmc_KMan_t *)pArg;
+    int f, status, fDone, RunId = p->pSat->RunId;
+    for ( f = 0; f < p->pPars->nFramesMax; f++ )
+    {
+        status = Bmc_KManBaseFrame( p, f );
+        pthread_mutex_lock(&g_KIndMutex);
+        if ( RunId < g_nKIndRunIds )
+            fDone = 1;
+        else if ( status == l_False )
+        {
+            g_iKIndBase = f;
+            fDone = g_iKIndStep >= 0 && f >= g_iKIndStep - 1;
+        }
+        else
+        {
+            g_nKIndRunIds++;
+            fDone = 1;
+        }
+        pthread_mutex_unlock(&g_KIndMutex);
+        if ( fDone )
+            break;
+    }
+    return NULL;
+}
+int Bmc_KIndSolvePar( Bmc_KMan_t * pBase, Bmc_KMan_t * pStep, Bmc_KIndPar_t * pPars )
+{
+    pthread_t BaseThread;
+    abctime clk = Abc_Clock();
+    int k, status, fDone, RunId;
+    // start a new run
+    pthread_mutex_lock(&g_KIndMutex);
+    RunId = ++g_nKIndRunIds;
+    g_iKIndBase = -1;
+    g_iKIndStep = -1;
+    pthread_mutex_unlock(&g_KIndMutex);
+    pBase->pSat->RunId = pStep->pSat->RunId = RunId;
+    pBase->pSat->pFuncStop = pStep->pSat->pFuncStop = Bmc_KIndCallBackToStop;
+    status = pthread_create( &BaseThread, NULL, Bmc_KIndBaseThread, (void *)pBase );
+    assert( status == 0 );
+    // deepen the inductive step
+    for ( k = 0; k < pPars->nFramesMax; k++ )
+    {
+        status = Bmc_KManStepFrame( pStep, k );
+        if ( pPars->fVerbose )
+            Bmc_KManPrintFrame( pBase, pStep, k, status, g_iKIndBase, clk );
+        pthread_mutex_lock(&g_KIndMutex);
+        fDone = RunId < g_nKIndRunIds;
+        if ( !fDone && status == l_True )
+        {
+            pthread_mutex_unlock(&g_KIndMutex);
+            continue;
+        }
+        if ( !fDone && status == l_False )
+        {
+            g_iKIndStep = k;
+            fDone = g_iKIndBase >= k - 1;
+        }
+        else
+            fDone = 1;
+        if ( fDone && RunId == g_nKIndRunIds )
+            g_nKIndRunIds++;
+        pthread_mutex_unlock(&g_KIndMutex);
+        break;
+    }
+    // the step is undecided within the frame limit
+    if ( k == pPars->nFramesMax )
+    {
+        pthread_mutex_lock(&g_KIndMutex);
+        if ( RunId == g_nKIndRunIds )
+            g_nKIndRunIds++;
+        pthread_mutex_unlock(&g_KIndMutex);
+    }
+    status = pthread_join( BaseThread, NULL );
+    assert( status == 0 );
+    pPars->iFrame = g_iKIndBase;
+    if ( pBase->pCex )
+        return 0;
+    if ( g_iKIndStep >= 0 && g_iKIndBase >= g_iKIndStep - 1 )
+    {
+        pPars->iDepth = g_iKIndStep;
+        return 1;
+    }
+    return -1;
+}
+#else
+int Bmc_KIndSolvePar( Bmc_KMan_t * pBase, Bmc_KMan_t * pStep, Bmc_KIndPar_t * pPars )
+{
+    return Bmc_KIndSolveSeq( pBase, pStep, pPars );
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs k-step induction for all outputs of the design.]
+
+  Description [The property is that all outputs are 0 in all reachable
+  states. The base case and the inductive step use two incremental
+  solvers, which are extended by one timeframe at a time. If the invariant
+  is given and fUseInvar is set, it is added to each timeframe of the step
+  to exclude unreachable states. Returns 1 if proved, 0 if disproved (the
+  counter-example is stored in the manager), -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PerformKInd( Gia_Man_t * p, Bmc_KIndPar_t * pPars, Vec_Int_t * vInv )
+{
+    Bmc_KMan_t * pBase, * pStep;
+    Cnf_Dat_t * pCnf;
+    abctime clkTotal = Abc_Clock();
+    abctime nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    int RetValue;
+    assert( Gia_ManRegNum(p) > 0 );
+    pPars->iFrame = -1;
+    pPars->iDepth = -1;
+    pCnf = Cnf_DeriveGiaRemapped( p );
+    if ( !pPars->fUseInvar )
+        vInv = NULL;
+    else if ( vInv == NULL )
+        printf( "The invariant is not available.\n" );
+    else if ( !Bmc_KIndCheckInvariant( p, pCnf, vInv, pPars ) )
+        vInv = NULL;
+    if ( pPars->fVerbose )
+    {
+        printf( "Running %d-induction with%s uniqueness constraints and with%s invariant on %d thread%s.  ",
+            pPars->nFramesMax, pPars->fUnique ? "":"out", vInv ? "":"out", Abc_MinInt(pPars->nProcs, 2), pPars->nProcs > 1 ? "s":"" );
+        printf( "CNF: Var = %d. Cla = %d.\n", pCnf->nVars, pCnf->nClauses );
+    }
+    pBase = Bmc_KManStart( p, pCnf, NULL, pPars, 1, nTimeToStop );
+    pStep = Bmc_KManStart( p, pCnf, vInv, pPars, 0, nTimeToStop );
+    if ( pPars->nProcs > 1 )
+        RetValue = Bmc_KIndSolvePar( pBase, pStep, pPars );
+    else
+        RetValue = Bmc_KIndSolveSeq( pBase, pStep, pPars );
+    if ( pPars->fVerbose )
+        printf( "SAT calls: Base = %d. Step = %d.  Uniqueness constraints = %d.\n", pBase->nSatCalls, pStep->nSatCalls, pStep->nUniques );
+    if ( RetValue == 1 )
+        printf( "Property proved by induction at depth %d.  ", pPars->iDepth );
+    else if ( RetValue == 0 )
+    {
+        if ( !Gia_ManVerifyCex( p, pBase->pCex, 0 ) )
+            printf( "Generated counter-example is INVALID.\n" );
+        printf( "Output %d of miter \"%s\" was asserted in frame %d.  ", pBase->pCex->iPo, p->pName ? p->pName : "", pBase->pCex->iFrame );
+        Abc_CexFreeP( &p->pCexSeq );
+        p->pCexSeq = pBase->pCex;
+        pBase->pCex = NULL;
+    }
+    else
+        printf( "Property UNDECIDED after proving %d frames.  ", pPars->iFrame + 1 );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    Bmc_KManStop( pBase );
+    Bmc_KManStop( pStep );
+    Cnf_DataFree( pCnf );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
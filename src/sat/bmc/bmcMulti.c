@@ -24,6 +24,17 @@
 #include "aig/gia/giaAig.h"
 #include "aig/ioa/ioa.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +42,17 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define BMC_MUL_THR_MAX 100
+
+typedef struct Bmc_MulThData_t_ Bmc_MulThData_t;
+struct Bmc_MulThData_t_
+{
+    Aig_Man_t *      pAig;         // the cones of one group of outputs
+    Vec_Int_t *      vCiMap;       // maps the CIs of the cones into the CIs of the original AIG
+    Saig_ParBmc_t    Pars;         // BMC parameters of this group
+    int              RetValue;     // the result of BMC
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -147,6 +169,208 @@ Aig_Man_t * Gia_ManMultiProveSyn( Aig_Man_t * p, int fVerbose, int fVeryVerbose
     return pAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Divides the outputs into groups with overlapping cones.]
+
+  Description [Outputs are considered in the order of decreasing support
+  size. Each output is added to the group sharing the largest number of
+  combinational inputs with it, among the groups that are not yet full.
+  The groups are balanced, so none has more than ceil(nPos/nGroups) outputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_ManMultiGroupOutputs( Aig_Man_t * p, int nGroups )
+{
+    Vec_Wec_t * vGroups;
+    Vec_Ptr_t * vSupps, * vPoSupps;
+    Vec_Int_t * vSupp, * vMarks, * vCosts;
+    int nPos = Saig_ManPoNum(p);
+    int nCis = Aig_ManCiNum(p);
+    int nLimit, * pOrder, i, k, g, iCi, iPo;
+    nGroups = Abc_MinInt( nGroups, nPos );
+    nLimit  = (nPos + nGroups - 1) / nGroups;
+    // collect the supports of the POs in the order of PO numbers
+    vSupps   = Aig_ManSupports( p );
+    Aig_ManSetCioIds( p ); // restores CI/CO numbers cleared by Aig_ManSupports()
+    vPoSupps = Vec_PtrStart( nPos );
+    Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSupp, i )
+    {
+        iPo = Vec_IntPop( vSupp );
+        if ( iPo < nPos )
+            Vec_PtrWriteEntry( vPoSupps, iPo, vSupp );
+    }
+    vCosts = Vec_IntAlloc( nPos );
+    Vec_PtrForEachEntry( Vec_Int_t *, vPoSupps, vSupp, i )
+        Vec_IntPush( vCosts, -Vec_IntSize(vSupp) );
+    pOrder = Abc_MergeSortCost( Vec_IntArray(vCosts), nPos );
+    // assign the outputs to the groups
+    vGroups = Vec_WecStart( nGroups );
+    vMarks  = Vec_IntStart( nGroups * nCis );
+    for ( i = 0; i < nPos; i++ )
+    {
+        int iBest = -1, nOverBest = -1;
+        vSupp = (Vec_Int_t *)Vec_PtrEntry( vPoSupps, pOrder[i] );
+        for ( g = 0; g < nGroups; g++ )
+        {
+            int nOver = 0, nSize = Vec_IntSize(Vec_WecEntry(vGroups, g));
+            if ( nSize == nLimit )
+                continue;
+            // an unrelated output starts a new group; the remaining groups are empty
+            if ( nSize == 0 )
+            {
+                if ( nOverBest <= 0 )
+                    iBest = g;
+                break;
+            }
+            Vec_IntForEachEntry( vSupp, iCi, k )
+                nOver += Vec_IntEntry( vMarks, g * nCis + iCi );
+            if ( nOverBest < nOver )
+                nOverBest = nOver, iBest = g;
+        }
+        assert( iBest >= 0 );
+        Vec_WecPush( vGroups, iBest, pOrder[i] );
+        Vec_IntForEachEntry( vSupp, iCi, k )
+            Vec_IntWriteEntry( vMarks, iBest * nCis + iCi, 1 );
+    }
+    // keep the outputs of each group in their original order
+    for ( g = 0; g < nGroups; g++ )
+        Vec_IntSort( Vec_WecEntry(vGroups, g), 0 );
+    Vec_WecRemoveEmpty( vGroups );
+    Vec_WecSortByFirstInt( vGroups, 0 );
+    ABC_FREE( pOrder );
+    Vec_IntFree( vCosts );
+    Vec_IntFree( vMarks );
+    Vec_PtrFree( vPoSupps );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    return vGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs BMC on the groups of outputs using concurrent threads.]
+
+  Description [The cones of each group are extracted into a separate AIG
+  and solved by its own instance of BMC. The calling thread works on the
+  first group. When all groups are finished, their CEXes are combined into
+  p->vSeqModelVec in the order of the outputs of p, as if BMC was applied
+  to p, so the rest of the flow does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+Vec_Int_t * Gia_ManMultiConeCiMap( Aig_Man_t * p, Aig_Man_t * pCone )
+{
+    // the CIs of p visited by Saig_ManDupCones() point to the CIs of the cones
+    Vec_Int_t * vCiMap = Vec_IntStartFull( Aig_ManCiNum(pCone) );
+    Aig_Obj_t * pObj;
+    int i;
+    Aig_ManForEachCi( p, pObj, i )
+        if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+            Vec_IntWriteEntry( vCiMap, Aig_ObjCioId((Aig_Obj_t *)pObj->pData), i );
+    return vCiMap;
+}
+Abc_Cex_t * Gia_ManMultiRemapCex( Aig_Man_t * p, Abc_Cex_t * pCex, Vec_Int_t * vCiMap, int iPo )
+{
+    Abc_Cex_t * pCexNew;
+    int i, f, iCi, nPis = Saig_ManPiNum(p);
+    if ( pCex == NULL || pCex == (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+        return pCex;
+    assert( pCex->nRegs + pCex->nPis == Vec_IntSize(vCiMap) );
+    pCexNew = Abc_CexAlloc( Saig_ManRegNum(p), nPis, pCex->iFrame + 1 );
+    pCexNew->iPo    = iPo;
+    pCexNew->iFrame = pCex->iFrame;
+    Vec_IntForEachEntry( vCiMap, iCi, i )
+    {
+        assert( iCi >= 0 );
+        if ( i < pCex->nPis ) // primary input
+        {
+            for ( f = 0; f <= pCex->iFrame; f++ )
+                if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + pCex->nPis * f + i) )
+                    Abc_InfoSetBit( pCexNew->pData, pCexNew->nRegs + nPis * f + iCi );
+        }
+        else if ( Abc_InfoHasBit(pCex->pData, i - pCex->nPis) ) // register
+            Abc_InfoSetBit( pCexNew->pData, iCi - nPis );
+    }
+    Abc_CexFree( pCex );
+    return pCexNew;
+}
+void * Gia_ManMultiWorkerThread( void * pArg )
+{
+    Bmc_MulThData_t * pThData = (Bmc_MulThData_t *)pArg;
+    pThData->RetValue = Saig_ManBmcScalable( pThData->pAig, &pThData->Pars );
+    return NULL;
+}
+int Gia_ManMultiBmcGroups( Aig_Man_t * p, Saig_ParBmc_t * pPars, int nProcs, int fVerbose )
+{
+    Bmc_MulThData_t ThData[BMC_MUL_THR_MAX];
+    pthread_t WorkerThread[BMC_MUL_THR_MAX];
+    Vec_Wec_t * vGroups;
+    Vec_Int_t * vGroup;
+    Abc_Cex_t * pCex;
+    int i, k, iPo, status, nGroups, RetValue = -1;
+    assert( p->vSeqModelVec == NULL );
+    vGroups = Gia_ManMultiGroupOutputs( p, Abc_MinInt(nProcs, BMC_MUL_THR_MAX) );
+    nGroups = Vec_WecSize( vGroups );
+    Vec_WecForEachLevel( vGroups, vGroup, i )
+    {
+        ThData[i].pAig     = Saig_ManDupCones( p, Vec_IntArray(vGroup), Vec_IntSize(vGroup) );
+        ThData[i].vCiMap   = Gia_ManMultiConeCiMap( p, ThData[i].pAig );
+        ThData[i].Pars     = *pPars;
+        ThData[i].RetValue = -1;
+        if ( fVerbose )
+            printf( "Group %3d : PO =%6d  PI =%6d  FF =%7d  ND =%7d\n", i, Vec_IntSize(vGroup), 
+                Saig_ManPiNum(ThData[i].pAig), Saig_ManRegNum(ThData[i].pAig), Aig_ManNodeNum(ThData[i].pAig) );
+    }
+    // the calling thread solves the first group
+    for ( i = 1; i < nGroups; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_ManMultiWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    Gia_ManMultiWorkerThread( (void *)ThData );
+    for ( i = 1; i < nGroups; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    // collect the results, translating the CEXes from the cones to p
+    p->vSeqModelVec = Vec_PtrStart( Saig_ManPoNum(p) );
+    pPars->iFrame = ThData[0].Pars.iFrame;
+    Vec_WecForEachLevel( vGroups, vGroup, i )
+    {
+        if ( ThData[i].pAig->vSeqModelVec )
+        {
+            Vec_IntForEachEntry( vGroup, iPo, k )
+            {
+                pCex = (Abc_Cex_t *)Vec_PtrEntry( ThData[i].pAig->vSeqModelVec, k );
+                Vec_PtrWriteEntry( ThData[i].pAig->vSeqModelVec, k, NULL );
+                Vec_PtrWriteEntry( p->vSeqModelVec, iPo, Gia_ManMultiRemapCex(p, pCex, ThData[i].vCiMap, iPo) );
+            }
+        }
+        if ( ThData[i].RetValue == 0 )
+            RetValue = 0;
+        // the groups that stopped early did not check the deeper frames
+        pPars->iFrame = Abc_MinInt( pPars->iFrame, ThData[i].Pars.iFrame );
+        Vec_IntFree( ThData[i].vCiMap );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    Vec_WecFree( vGroups );
+    return RetValue;
+}
+#else
+int Gia_ManMultiBmcGroups( Aig_Man_t * p, Saig_ParBmc_t * pPars, int nProcs, int fVerbose )
+{
+    return Saig_ManBmcScalable( p, pPars );
+}
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -175,8 +399,8 @@ Vec_Ptr_t * Gia_ManMultiProveAig( Aig_Man_t * p, Bmc_MulPar_t * pPars )
         printf( "MultiProve parameters: Global timeout = %d sec.  Local timeout = %d sec.  Time increase = %d %%.\n", 
             pPars->TimeOutGlo, pPars->TimeOutLoc, pPars->TimeOutInc );
     if ( pPars->fVerbose )
-        printf( "Gap timout = %d sec. Per-output timeout = %d msec. Use synthesis = %d. Dump final = %d. Verbose = %d.\n", 
-            pPars->TimeOutGap, pPars->TimePerOut, pPars->fUseSyn, pPars->fDumpFinal, pPars->fVerbose );
+        printf( "Gap timout = %d sec. Per-output timeout = %d msec. Use synthesis = %d. Dump final = %d. Threads = %d. Verbose = %d.\n", 
+            pPars->TimeOutGap, pPars->TimePerOut, pPars->fUseSyn, pPars->fDumpFinal, pPars->nProcs, pPars->fVerbose );
     // create output map
     vOutMap = Vec_IntStartNatural( Saig_ManPoNum(p) ); // maps current outputs into their original IDs
     vCexes  = Vec_PtrStart( Saig_ManPoNum(p) );        // maps solved outputs into their CEXes (or markers)
@@ -220,7 +444,10 @@ Vec_Ptr_t * Gia_ManMultiProveAig( Aig_Man_t * p, Bmc_MulPar_t * pPars )
         pParsBmc->fSilent = !pPars->fVeryVerbose;
         pParsBmc->nTimeOut = TimeOutLoc;
         pParsBmc->nTimeOutOne = pPars->TimePerOut;
-        RetValue *= Saig_ManBmcScalable( p, pParsBmc );
+        if ( pPars->nProcs > 1 && Saig_ManPoNum(p) > 1 )
+            RetValue *= Gia_ManMultiBmcGroups( p, pParsBmc, pPars->nProcs, pPars->fVeryVerbose );
+        else
+            RetValue *= Saig_ManBmcScalable( p, pParsBmc );
         if ( pPars->fVeryVerbose )
             Abc_Print( 1, "Some outputs are SAT (%d out of %d) after %d frames.\n", 
                 Saig_ManPoNum(p) - Vec_PtrCountZero(p->vSeqModelVec), Saig_ManPoNum(p), pParsBmc->iFrame );
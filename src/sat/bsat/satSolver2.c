@@ -1050,7 +1050,8 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             // NO CONFLICT
             int next;
 
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) ||
+                (s->pFuncStop && (s->stats.conflicts & 63) == 0 && s->pFuncStop(s->RunId))){
                 // Reached bound on number of conflicts:
                 s->progress_estimate = solver2_progress(s);
                 solver2_canceluntil(s,s->root_level);
@@ -1571,6 +1572,9 @@ void sat_solver2_reducedb(sat_solver2* s)
         extern int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot );
         s->hProofPivot = Sat_ProofReduce( s->pPrf1, &s->claProofs, s->hProofPivot );
     }
+    // compact interpolant (removes partial interpolants of deleted clauses)
+    if ( s->pInt2 )
+        Int2_ManCompact( s->pInt2 );
 
     // report the results
     TimeTotal += Abc_Clock() - clk;
@@ -1971,6 +1975,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
+        if ( s->pFuncStop && s->pFuncStop(s->RunId) )
+            break;
     }
     if (s->verbosity >= 1)
         Abc_Print(1,"==============================================================================\n");
@@ -36,6 +36,7 @@ struct Int2_Man_t_
     Vec_Int_t *     vGloVars;  // IDs of global variables
     Vec_Int_t *     vVar2Glo;  // mapping of SAT variables into their global IDs
     Gia_Man_t *     pGia;      // AIG manager to store the interpolant
+    int             nObjsLast; // the number of objects after the last compaction
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -66,6 +67,7 @@ Int2_Man_t * Int2_ManStart( sat_solver2 * pSat, int * pGloVars, int nGloVars )
     for ( i = 0; i < nGloVars; i++ )
         Gia_ManAppendCi( p->pGia );
     Gia_ManHashStart( p->pGia );
+    p->nObjsLast = Gia_ManObjNum( p->pGia );
     return p;
 }
 void Int2_ManStop( Int2_Man_t * p )
@@ -80,10 +82,11 @@ void Int2_ManStop( Int2_Man_t * p )
 void * Int2_ManReadInterpolant( sat_solver2 * pSat )
 {
     Int2_Man_t * p = pSat->pInt2;
-    Gia_Man_t * pTemp, * pGia = p->pGia; p->pGia = NULL;
+    Gia_Man_t * pTemp, * pGia = p->pGia;
     // return NULL, if the interpolant is not ready (for example, when the solver returned 'sat')
     if ( pSat->hProofLast == -1 )
         return NULL;
+    p->pGia = NULL;
     // create AIG with one primary output
     assert( Gia_ManPoNum(pGia) == 0 );
     Gia_ManAppendCo( pGia, pSat->hProofLast );  
@@ -142,6 +145,65 @@ int Int2_ManChainResolve( Int2_Man_t * p, clause * c, int iLit, int varA )
     return iLit;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Removes the partial interpolants of deleted clauses.]
+
+  Description [Called after the learned clause database is reduced.
+  Only the cones of the partial interpolants of the remaining learned
+  clauses are copied into the new AIG. The partial interpolants of the
+  problem clauses of part A are recomputed when they are used next time.
+  The AIG is compacted only if it has doubled since the last compaction.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Int2_ManCompact_rec( Gia_Man_t * pNew, Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( ~pObj->Value )
+        return pObj->Value;
+    assert( Gia_ObjIsAnd(pObj) );
+    Int2_ManCompact_rec( pNew, p, Gia_ObjFaninId0(pObj, iObj) );
+    Int2_ManCompact_rec( pNew, p, Gia_ObjFaninId1(pObj, iObj) );
+    return pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+}
+void Int2_ManCompact( Int2_Man_t * p )
+{
+    sat_solver2 * s = p->pSat;
+    Sat_Mem_t * pMem = &s->Mem;
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    clause * c;
+    int * pProofs = veci_begin( &s->claProofs );
+    int i, k, iLit;
+    assert( s->tempInter == -1 );
+    if ( Gia_ManObjNum(p->pGia) < 2 * p->nObjsLast )
+        return;
+    // copy the cones of the remaining partial interpolants
+    pNew = Gia_ManStart( Gia_ManObjNum(p->pGia) );
+    pNew->pName = Abc_UtilStrsav( p->pGia->pName );
+    Gia_ManFillValue( p->pGia );
+    Gia_ManConst0(p->pGia)->Value = 0;
+    Gia_ManForEachCi( p->pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashStart( pNew );
+    for ( i = 0; i < veci_size(&s->claProofs); i++ )
+    {
+        iLit = pProofs[i];
+        pProofs[i] = Abc_LitNotCond( Int2_ManCompact_rec(pNew, p->pGia, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+    }
+    Gia_ManStop( p->pGia );
+    p->pGia = pNew;
+    p->nObjsLast = Gia_ManObjNum( pNew );
+    // reset the partial interpolants of the problem clauses
+    Sat_MemForEachClause2( pMem, c, i, k )
+        if ( c->partA )
+            c->lits[c->size] = -1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Test for the interpolation procedure.]